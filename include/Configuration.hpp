@@ -39,6 +39,13 @@ public:
      * Size of stack of user main thread in bytes.
      */    
     int32 stackSize;
+    
+    /**
+     * Interrupt source of software interrupts, or -1 if they are not used.
+     *
+     * The source has to be not used by hardware, since it is set by software only.
+     */
+    int32 swiSource;
   
     /** 
      * Constructor.
@@ -55,7 +62,8 @@ public:
         cpuClock    (obj.cpuClock),
         heapAddr    (obj.heapAddr),
         heapSize    (obj.heapSize),
-        stackSize   (obj.stackSize){
+        stackSize   (obj.stackSize),
+        swiSource   (obj.swiSource){
     }
         
     /** 
@@ -78,6 +86,7 @@ public:
         heapAddr    = obj.heapAddr;
         heapSize    = obj.heapSize;
         stackSize   = obj.stackSize;
+        swiSource   = obj.swiSource;
         return *this;
     }
      
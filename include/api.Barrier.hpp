@@ -0,0 +1,52 @@
+/**
+ * Cyclic barrier interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_BARRIER_HPP_
+#define API_BARRIER_HPP_
+
+#include "api.Object.hpp"
+
+namespace api
+{
+    class Barrier : public ::api::Object
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~Barrier(){}
+
+        /**
+         * Waits till all parties have called this method.
+         *
+         * The last arriving thread releases all waiting threads,
+         * and the barrier is ready for the next cycle at once.
+         *
+         * @return the arrival index where the first thread gets the number of parties minus one,
+         *         and the last thread gets zero, or -1 if error has been occurred.
+         */
+        virtual int32 await() = 0;
+
+        /**
+         * Returns a number of parties required to trip this barrier.
+         *
+         * @return the number of parties.
+         */
+        virtual int32 getParties() const = 0;
+
+        /**
+         * Returns a number of threads which are waiting at this barrier.
+         *
+         * @return the number of waiting threads.
+         */
+        virtual int32 getNumberWaiting() const = 0;
+
+    };
+}
+#endif // API_BARRIER_HPP_
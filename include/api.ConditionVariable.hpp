@@ -0,0 +1,60 @@
+/**
+ * Condition variable interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_CONDITION_VARIABLE_HPP_
+#define API_CONDITION_VARIABLE_HPP_
+
+#include "api.Object.hpp"
+#include "api.Mutex.hpp"
+
+namespace api
+{
+    class ConditionVariable : public ::api::Object
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~ConditionVariable(){}
+
+        /**
+         * Waits for a notification of this condition variable.
+         *
+         * The method unlocks given mutex and parks current thread atomically,
+         * and locks the mutex again when the thread has been notified.
+         *
+         * @param mutex a mutex which is locked by current thread.
+         * @return true if the thread has been notified.
+         */
+        virtual bool wait(::api::Mutex& mutex) = 0;
+
+        /**
+         * Waits for a notification of this condition variable within given time.
+         *
+         * The mutex is locked again regardless of the thread has been notified or not.
+         *
+         * @param mutex   a mutex which is locked by current thread.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the thread has been notified, or false if the time has elapsed.
+         */
+        virtual bool wait(::api::Mutex& mutex, int64 timeout) = 0;
+
+        /**
+         * Wakes up one thread which waits for this condition variable.
+         */
+        virtual void notifyOne() = 0;
+
+        /**
+         * Wakes up all threads which wait for this condition variable.
+         */
+        virtual void notifyAll() = 0;
+
+    };
+}
+#endif // API_CONDITION_VARIABLE_HPP_
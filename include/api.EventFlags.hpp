@@ -0,0 +1,89 @@
+/**
+ * Event flags interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_EVENT_FLAGS_HPP_
+#define API_EVENT_FLAGS_HPP_
+
+#include "api.Resource.hpp"
+
+namespace api
+{
+    class EventFlags : public ::api::Resource
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~EventFlags(){}
+
+        /**
+         * Sets the flags of given mask.
+         *
+         * The method might be called in an interrupt context. Interrupts are
+         * disabled while every waiting thread is tested.
+         *
+         * @param mask the flags to set.
+         */
+        virtual void set(uint32 mask) = 0;
+
+        /**
+         * Clears the flags of given mask.
+         *
+         * @param mask the flags to clear.
+         */
+        virtual void clear(uint32 mask) = 0;
+
+        /**
+         * Returns the current flags.
+         *
+         * @return the flags value.
+         */
+        virtual uint32 getValue() const = 0;
+
+        /**
+         * Waits for any flag of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear) = 0;
+
+        /**
+         * Waits for any flag of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear, int64 timeout) = 0;
+
+        /**
+         * Waits for all flags of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear) = 0;
+
+        /**
+         * Waits for all flags of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear, int64 timeout) = 0;
+
+    };
+}
+#endif // API_EVENT_FLAGS_HPP_
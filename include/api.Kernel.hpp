@@ -14,7 +14,13 @@
 #include "api.Scheduler.hpp"
 #include "api.Mutex.hpp"
 #include "api.Semaphore.hpp"
+#include "api.ConditionVariable.hpp"
+#include "api.ReadWriteLock.hpp"
+#include "api.Barrier.hpp"
+#include "api.EventFlags.hpp"
+#include "api.MessageQueue.hpp"
 #include "api.Interrupt.hpp"
+#include "api.SoftwareTimer.hpp"
 #include "api.Task.hpp"
 #include "api.Toggle.hpp"
 
@@ -72,6 +78,18 @@ namespace api
          */      
         virtual ::api::Mutex* createMutex() = 0;
         
+        /** 
+         * Creates new priority ceiling mutex resource.
+         *
+         * A thread which locks the mutex is immediately executed with the ceiling 
+         * priority until it unlocks the mutex, therefore the mutex must not be 
+         * locked by threads which priorities are higher than the ceiling.
+         *
+         * @param ceiling the highest priority of threads which lock the mutex.
+         * @return new mutex resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::Mutex* createMutex(int32 ceiling) = 0;
+        
         /** 
          * Creates new unfair semaphore resource.
          *
@@ -89,6 +107,46 @@ namespace api
          */      
         virtual ::api::Semaphore* createSemaphore(int32 permits, bool isFair) = 0;
         
+        /** 
+         * Creates new condition variable resource.
+         *
+         * @return new condition variable resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::ConditionVariable* createConditionVariable() = 0;
+        
+        /** 
+         * Creates new reader-writer lock resource.
+         *
+         * @return new reader-writer lock resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::ReadWriteLock* createReadWriteLock() = 0;
+        
+        /** 
+         * Creates new cyclic barrier resource.
+         *
+         * @param parties a number of threads which have to arrive to trip the barrier.
+         * @return new barrier resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::Barrier* createBarrier(int32 parties) = 0;
+        
+        /** 
+         * Creates new event flags resource.
+         *
+         * @return new event flags resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::EventFlags* createEventFlags() = 0;
+        
+        /** 
+         * Creates new message queue resource.
+         *
+         * The memory of all messages is allocated once by this method.
+         *
+         * @param size     a size of messages in bytes.
+         * @param capacity a number of messages which the queue might contain.
+         * @return new message queue resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::MessageQueue* createMessageQueue(int32 size, int32 capacity) = 0;
+        
         /**
          * Creates new interrupt resource.
          *
@@ -98,6 +156,30 @@ namespace api
          */  
         virtual ::api::Interrupt* createInterrupt(::api::Task& handler, int32 source) = 0;
 
+        /**
+         * Creates new software interrupt resource.
+         *
+         * The handlers of software interrupts are run to completion on one shared stack
+         * after hardware interrupt handlers return, and before threads are resumed.
+         * The handlers are run with maskable interrupts enabled, so they are preempted
+         * by hardware interrupts, and they preempt threads.
+         *
+         * @param handler  user class which implements an interrupt handler interface.
+         * @param priority a priority of the interrupt in range [0, 31] where 31 is the highest.
+         * @return new software interrupt resource, or NULL if error has been occurred.
+         */
+        virtual ::api::Interrupt* createSoftwareInterrupt(::api::Task& handler, int32 priority) = 0;
+
+        /**
+         * Creates new software timer resource.
+         *
+         * The handlers of all software timers are run by one thread of the highest priority.
+         *
+         * @param handler user class which implements a timer handler interface.
+         * @return new software timer resource, or NULL if error has been occurred.
+         */
+        virtual ::api::SoftwareTimer* createSoftwareTimer(::api::Task& handler) = 0;
+
     };
 }
 #endif // API_KERNEL_HPP_
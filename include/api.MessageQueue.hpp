@@ -0,0 +1,108 @@
+/**
+ * Message queue interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_MESSAGE_QUEUE_HPP_
+#define API_MESSAGE_QUEUE_HPP_
+
+#include "api.Resource.hpp"
+
+namespace api
+{
+    class MessageQueue : public ::api::Resource
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~MessageQueue(){}
+
+        /**
+         * Sends a message.
+         *
+         * The method copies the message to this queue or waits
+         * while the queue is full.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool send(const void* message) = 0;
+
+        /**
+         * Sends a message within given time.
+         *
+         * @param message a message of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been sent, or false if the time has elapsed.
+         */
+        virtual bool send(const void* message, int64 timeout) = 0;
+
+        /**
+         * Sends a message only if this queue is not full.
+         *
+         * The method might be called in an interrupt context.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool trySend(const void* message) = 0;
+
+        /**
+         * Receives a message.
+         *
+         * The method copies the head message of this queue or waits
+         * while the queue is empty.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool receive(void* message) = 0;
+
+        /**
+         * Receives a message within given time.
+         *
+         * @param message a buffer of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been received, or false if the time has elapsed.
+         */
+        virtual bool receive(void* message, int64 timeout) = 0;
+
+        /**
+         * Receives a message only if this queue is not empty.
+         *
+         * The method might be called in an interrupt context.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool tryReceive(void* message) = 0;
+
+        /**
+         * Returns a size of messages.
+         *
+         * @return the message size in bytes.
+         */
+        virtual int32 getSize() const = 0;
+
+        /**
+         * Returns a number of messages which this queue might contain.
+         *
+         * @return the capacity of the queue.
+         */
+        virtual int32 getCapacity() const = 0;
+
+        /**
+         * Returns a number of messages in this queue.
+         *
+         * @return the number of messages.
+         */
+        virtual int32 getLength() const = 0;
+
+    };
+}
+#endif // API_MESSAGE_QUEUE_HPP_
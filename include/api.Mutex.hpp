@@ -29,6 +29,21 @@ namespace api
          */
         virtual bool lock() = 0;
         
+        /**
+         * Locks this mutex within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this mutex is locked successfully, or false if the time has elapsed.
+         */
+        virtual bool lock(int64 timeout) = 0;
+        
+        /**
+         * Locks this mutex only if it is not held by another thread.
+         *
+         * @return true if this mutex is locked successfully.
+         */
+        virtual bool tryLock() = 0;
+        
         /**
          * Unlocks this mutex.
          */
@@ -0,0 +1,86 @@
+/**
+ * Reader-writer lock interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_READ_WRITE_LOCK_HPP_
+#define API_READ_WRITE_LOCK_HPP_
+
+#include "api.Object.hpp"
+
+namespace api
+{
+    class ReadWriteLock : public ::api::Object
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~ReadWriteLock(){}
+
+        /**
+         * Locks this lock for reading.
+         *
+         * Any number of threads might hold the lock for reading together,
+         * but a thread waits while the lock is held or waited for writing.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool readLock() = 0;
+
+        /**
+         * Locks this lock for reading within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool readLock(int64 timeout) = 0;
+
+        /**
+         * Locks this lock for reading only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryReadLock() = 0;
+
+        /**
+         * Unlocks this lock held for reading.
+         */
+        virtual void readUnlock() = 0;
+
+        /**
+         * Locks this lock for writing.
+         *
+         * Only one thread might hold the lock for writing, and no thread might hold it for reading then.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool writeLock() = 0;
+
+        /**
+         * Locks this lock for writing within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool writeLock(int64 timeout) = 0;
+
+        /**
+         * Locks this lock for writing only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryWriteLock() = 0;
+
+        /**
+         * Unlocks this lock held for writing.
+         */
+        virtual void writeUnlock() = 0;
+
+    };
+}
+#endif // API_READ_WRITE_LOCK_HPP_
@@ -33,6 +33,21 @@ namespace api
          */
         virtual ::api::Thread* createThread(::api::Task& task) = 0;
         
+        /**
+         * Creates a new earliest deadline first thread.
+         *
+         * The thread is executed for the budget time in each period before the 
+         * relative deadline, and it is created only if the utilization of all 
+         * earliest deadline first threads does not exceed the processor time.
+         *
+         * @param task     an user task which main method will be invoked when created thread is started.
+         * @param period   the thread period in nanoseconds.
+         * @param budget   the thread execution time in each period in nanoseconds.
+         * @param deadline the relative deadline of each period in nanoseconds.
+         * @return a new thread, or NULL if the thread is not admitted.
+         */
+        virtual ::api::Thread* createThread(::api::Task& task, int64 period, int64 budget, int64 deadline) = 0;
+        
         /**
          * Returns currently executing thread.
          *
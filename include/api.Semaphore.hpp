@@ -43,6 +43,33 @@ namespace api
          */  
         virtual bool acquire(int32 permits) = 0;
         
+        /**
+         * Acquires the given number of permits from this semaphore within given time.
+         *
+         * The method acquires given permits number or waits
+         * while the number will be released, but not longer than the timeout.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the semaphore is acquired successfully, or false if the time has elapsed.
+         */  
+        virtual bool acquire(int32 permits, int64 timeout) = 0;
+        
+        /**
+         * Acquires one permit from this semaphore only if it is available.
+         *
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire() = 0;
+        
+        /**
+         * Acquires the given number of permits from this semaphore only if they are available.
+         *
+         * @param permits the number of permits to acquire.
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire(int32 permits) = 0;
+        
         /**
          * Releases one permit.
          *
@@ -62,6 +89,11 @@ namespace api
         /**
          * Tests if this semaphore is fair.
          *
+         * A fair semaphore grants permits in order of requesting them under contention,
+         * so an acquiring thread does not pass the threads which wait for permits.
+         * The fairness orders the granting only, and a releasing thread never waits
+         * for threads which have acquired the semaphore before it.
+         *
          * @return true if this semaphore has fairness set true.
          */  
         virtual bool isFair() const = 0;
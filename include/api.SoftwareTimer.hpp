@@ -0,0 +1,67 @@
+/**
+ * Software timer interface.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_SOFTWARE_TIMER_HPP_
+#define API_SOFTWARE_TIMER_HPP_
+
+#include "api.Object.hpp"
+
+namespace api
+{
+    class SoftwareTimer : public ::api::Object
+    {
+
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~SoftwareTimer(){}
+
+        /**
+         * Starts this timer for one expiration.
+         *
+         * The handler of the timer is called once when the delay has elapsed.
+         * A started timer is restarted with new delay.
+         * The method might be called in an interrupt context.
+         *
+         * @param delay the time to expiration in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay) = 0;
+
+        /**
+         * Starts this timer for periodic expirations.
+         *
+         * The handler of the timer is called when the delay has elapsed,
+         * and then every period till the timer is stopped.
+         * The method might be called in an interrupt context.
+         *
+         * @param delay  the time to first expiration in nanoseconds.
+         * @param period the time between expirations in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay, int64 period) = 0;
+
+        /**
+         * Stops this timer.
+         *
+         * The method does not wait for the handler which is being executed.
+         * The method might be called in an interrupt context.
+         */
+        virtual void stop() = 0;
+
+        /**
+         * Tests if this timer is started.
+         *
+         * @return true if this timer waits for an expiration.
+         */
+        virtual bool isActive() const = 0;
+
+    };
+}
+#endif // API_SOFTWARE_TIMER_HPP_
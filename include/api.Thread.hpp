@@ -66,6 +66,14 @@ namespace api
          * Waits for this thread to die.
          */  
         virtual void join() = 0;
+        
+        /**
+         * Waits for this thread to die within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this thread has died, or false if the time has elapsed.
+         */  
+        virtual bool join(int64 timeout) = 0;
       
         /**
          * Causes this thread to sleep.
@@ -82,6 +90,61 @@ namespace api
          */  
         virtual void block(::api::Resource& res) = 0;        
         
+        /**
+         * Blocks this thread on given resources till any of them is not blocked.
+         *
+         * The thread is woken up by kernel semaphores, mutexes, event flags and message queues
+         * directly when they might have become not blocked. If the set contains another resource,
+         * the scheduler polls the set as it does for one blocking resource. The method does not 
+         * acquire the resource which index is returned.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @return an index of the first resource which is not blocked, or -1 if error has been occurred.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count) = 0;
+        
+        /**
+         * Blocks this thread on given resources till any of them is not blocked or given time elapses.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @param timeout   the maximum time to wait in nanoseconds.
+         * @return an index of the first resource which is not blocked, or -1 if the time has elapsed.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count, int64 timeout) = 0;
+        
+        /**
+         * Sets notification bits of this thread.
+         *
+         * The thread is woken up directly if it waits for any of the bits.
+         * The method might be called in an interrupt context.
+         *
+         * @param bits the bits to set.
+         */  
+        virtual void notify(uint32 bits) = 0;
+        
+        /**
+         * Waits for any notification bit of given mask.
+         *
+         * The method is called by this thread only, and the returned bits are cleared.
+         *
+         * @param mask the bits to wait for.
+         * @return the notification bits of the mask, or zero if error has been occurred.
+         */  
+        virtual uint32 waitNotification(uint32 mask) = 0;
+        
+        /**
+         * Waits for any notification bit of given mask within given time.
+         *
+         * The method is called by this thread only, and the returned bits are cleared.
+         *
+         * @param mask    the bits to wait for.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the notification bits of the mask, or zero if the time has elapsed.
+         */  
+        virtual uint32 waitNotification(uint32 mask, int64 timeout) = 0;
+        
         /**
          * Returns the identifier of this thread.
          *
@@ -109,6 +172,76 @@ namespace api
          * @return this thread status.
          */  
         virtual Status getStatus() const = 0;          
+        
+        /**
+         * Sets this thread period.
+         *
+         * The first period of the thread begins at the calling time. The period 
+         * of an earliest deadline first thread is set when the thread is created
+         * and is not changed by the method.
+         *
+         * @param nanos the period in nanoseconds, or zero to reset periodic mode.
+         */  
+        virtual void setPeriod(int64 nanos) = 0;
+        
+        /**
+         * Causes this thread to wait for the beginning of next period.
+         *
+         * The periods begin on absolute boundaries, so a periodic loop does not drift.
+         * If the next period has already begun, the thread continues at once.
+         */  
+        virtual void waitNextPeriod() = 0;
+        
+        /**
+         * Returns a number of periods which this thread has overrun.
+         *
+         * A period is overrun if the thread exceeds its budget, or if a thread 
+         * without a budget has not waited for the next period before it begins.
+         *
+         * @return number of overruns.
+         */  
+        virtual int32 getOverrunCount() const = 0;
+        
+        /**
+         * Returns a number of deadlines which this thread has missed.
+         *
+         * A deadline is missed if a thread with a budget waits for the next period 
+         * after its deadline. A late thread without a budget overruns its period,
+         * and the lateness is not counted as a deadline miss.
+         *
+         * @return number of deadline misses.
+         */  
+        virtual int32 getMissCount() const = 0;
+        
+        /**
+         * Returns the processor time which this thread has been executed.
+         *
+         * @return time in nanoseconds.
+         */  
+        virtual int64 getRunTime() const = 0;
+        
+        /**
+         * Returns the time when this thread has been switched to last time.
+         *
+         * @return time in nanoseconds, or -1 if the thread has never been executed.
+         */  
+        virtual int64 getDispatchTime() const = 0;
+        
+        /**
+         * Returns a number of switches from this thread which the thread has caused itself.
+         *
+         * The thread causes a switch when it yields, sleeps, waits, or blocks on a resource.
+         *
+         * @return number of voluntary switches.
+         */  
+        virtual int64 getVoluntarySwitchCount() const = 0;
+        
+        /**
+         * Returns a number of switches from this thread which have preempted the thread.
+         *
+         * @return number of involuntary switches.
+         */  
+        virtual int64 getInvoluntarySwitchCount() const = 0;
          
     };
 }
@@ -0,0 +1,294 @@
+/**
+ * Lock-free ring of one producer and one consumer.
+ *
+ * The ring passes elements from one producer to one consumer, for example from
+ * an interrupt handler to a thread, without allocating memory and without masking
+ * interrupts. The producer changes the tail index only and the consumer changes
+ * the head index only, and the indexes are placed on separate cache lines, so
+ * both sides never write to one line. The indexes run freely and are reduced by
+ * the mask of the capacity which must be a power of two.
+ *
+ * A semaphore might be given for waking the consumer up, then each push of
+ * elements releases one permit, and the consumer waits for the permit when
+ * the ring is empty.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SPSC_RING_HPP_
+#define LIBRARY_SPSC_RING_HPP_
+
+#include "Object.hpp"
+#include "api.Semaphore.hpp"
+
+namespace library
+{
+    /**
+     * @param Type  data type of ring element.
+     * @param COUNT count of ring elements which is a power of two.
+     * @param Alloc heap memory allocator class.
+     */
+    template <typename Type, int32 COUNT, class Alloc=::Allocator>
+    class SpscRing : public ::Object<Alloc>
+    {
+        typedef ::Object<Alloc> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        SpscRing() : Parent(),
+            head_      (0),
+            tail_      (0),
+            semaphore_ (NULL){
+        }
+
+        /**
+         * Constructor.
+         *
+         * @param semaphore a semaphore which is released when elements are pushed.
+         */
+        SpscRing(::api::Semaphore& semaphore) : Parent(),
+            head_      (0),
+            tail_      (0),
+            semaphore_ (&semaphore){
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~SpscRing()
+        {
+        }
+
+        /**
+         * Inserts an element to the tail of this ring.
+         *
+         * The method is called by the producer only.
+         *
+         * @param element an inserting element.
+         * @return true if the element has been inserted.
+         */
+        bool push(const Type& element)
+        {
+            return push(&element, 1) == 1 ? true : false;
+        }
+
+        /**
+         * Inserts elements to the tail of this ring.
+         *
+         * The method is called by the producer only.
+         *
+         * @param elements an array of inserting elements.
+         * @param count    a number of the elements.
+         * @return a number of inserted elements which is less than given if the ring is full.
+         */
+        int32 push(const Type* elements, int32 count)
+        {
+            uint32 tail = tail_;
+            uint32 free = COUNT - (tail - head_);
+            uint32 number = count > 0 ? static_cast<uint32>(count) : 0;
+            if(number > free) number = free;
+            if(number == 0) return 0;
+            for(uint32 i=0; i<number; i++) buffer_[(tail + i) & MASK] = elements[i];
+            // The elements have to be written before the consumer sees them
+            barrier();
+            tail_ = tail + number;
+            if(semaphore_ != NULL) semaphore_->release();
+            return static_cast<int32>(number);
+        }
+
+        /**
+         * Removes the head element of this ring.
+         *
+         * The method is called by the consumer only.
+         *
+         * @param element a reference to the removed element.
+         * @return true if the element has been removed.
+         */
+        bool pop(Type& element)
+        {
+            return pop(&element, 1) == 1 ? true : false;
+        }
+
+        /**
+         * Removes elements from the head of this ring.
+         *
+         * The method is called by the consumer only.
+         *
+         * @param elements an array for the removed elements.
+         * @param count    a number of elements the array might contain.
+         * @return a number of removed elements which is less than given if the ring is empty.
+         */
+        int32 pop(Type* elements, int32 count)
+        {
+            uint32 head = head_;
+            uint32 length = tail_ - head;
+            uint32 number = count > 0 ? static_cast<uint32>(count) : 0;
+            if(number > length) number = length;
+            if(number == 0) return 0;
+            // The elements have to be read after the producer has written them
+            barrier();
+            for(uint32 i=0; i<number; i++) elements[i] = buffer_[(head + i) & MASK];
+            // The elements have to be read before the producer overwrites them
+            barrier();
+            head_ = head + number;
+            return static_cast<int32>(number);
+        }
+
+        /**
+         * Waits for elements to be pushed.
+         *
+         * The method is called by the consumer only,
+         * and returns immediately if the ring has elements.
+         *
+         * @return true if the ring has elements, or false if the ring has no semaphore.
+         */
+        bool wait()
+        {
+            // Permits of popped elements are acquired till the ring becomes not empty
+            while( isEmpty() )
+            {
+                if(semaphore_ == NULL || not semaphore_->acquire()) return false;
+            }
+            return true;
+        }
+
+        /**
+         * Returns a number of elements in this ring.
+         *
+         * @return number of elements.
+         */
+        int32 getLength() const
+        {
+            return static_cast<int32>(tail_ - head_);
+        }
+
+        /**
+         * Returns a number of elements which this ring might contain.
+         *
+         * @return the capacity.
+         */
+        int32 getCapacity() const
+        {
+            return COUNT;
+        }
+
+        /**
+         * Tests if this ring has no elements.
+         *
+         * @return true if this ring contains no elements.
+         */
+        bool isEmpty() const
+        {
+            return tail_ == head_ ? true : false;
+        }
+
+        /**
+         * Tests if this ring has no free places.
+         *
+         * @return true if this ring is full.
+         */
+        bool isFull() const
+        {
+            return tail_ - head_ == COUNT ? true : false;
+        }
+
+    private:
+
+        /**
+         * Prevents the compiler from moving memory accesses over this point.
+         *
+         * GCC compatible compilers get an explicit compiler barrier. Other compilers,
+         * as the TI ones, call a function through a volatile pointer. The compiler 
+         * does not know the called function, so it might not move the accesses to 
+         * the elements, which are not volatile, over the call.
+         */
+        static void barrier()
+        {
+            #if defined(__GNUC__)
+            __asm__ __volatile__("" ::: "memory");
+            #else
+            static void (* volatile const call)() = &SpscRing::fence;
+            call();
+            #endif
+        }
+        
+        /**
+         * Does nothing being called as a barrier.
+         */
+        static void fence()
+        {
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SpscRing(const SpscRing& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SpscRing& operator =(const SpscRing& obj);
+
+        /**
+         * Mask of the ring indexes.
+         */
+        static const uint32 MASK = COUNT - 1;
+
+        /**
+         * Padding of the indexes which places them on separate cache lines.
+         */
+        #if defined(_TMS320C6X)
+        static const int32 PAD = 128 - sizeof(uint32);
+        #elif defined(__TMS320C28XX__)
+        static const int32 PAD = 1;
+        #else
+        static const int32 PAD = 64 - sizeof(uint32);
+        #endif
+
+        /**
+         * The capacity must be a power of two.
+         */
+        typedef char PowerOfTwo[ COUNT > 0 && (COUNT & (COUNT - 1)) == 0 ? 1 : -1 ];
+
+        /**
+         * Index of the head element which is changed by the consumer.
+         */
+        volatile uint32 head_;
+
+        /**
+         * Padding of the head index to the end of its cache line.
+         */
+        cell headPad_[PAD];
+
+        /**
+         * Index of the place after the tail element which is changed by the producer.
+         */
+        volatile uint32 tail_;
+
+        /**
+         * Padding of the tail index to the end of its cache line.
+         */
+        cell tailPad_[PAD];
+
+        /**
+         * The elements.
+         */
+        Type buffer_[COUNT];
+
+        /**
+         * A semaphore for waking the consumer up, or NULL.
+         */
+        ::api::Semaphore* semaphore_;
+
+    };
+}
+#endif // LIBRARY_SPSC_RING_HPP_
@@ -0,0 +1,127 @@
+/**
+ * Cyclic barrier class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_BARRIER_HPP_
+#define SYSTEM_BARRIER_HPP_
+
+#include "Object.hpp"
+#include "api.Barrier.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class Barrier : public ::Object<>, public ::api::Barrier
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param parties a number of threads which have to arrive to trip the barrier.
+         */
+        Barrier(int32 parties) : Parent(),
+            isConstructed_ (getConstruct()),
+            barrier_       (NULL){
+            setConstruct( construct(parties) );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~Barrier()
+        {
+            delete barrier_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Waits till all parties have called this method.
+         *
+         * @return the arrival index, or -1 if error has been occurred.
+         */
+        virtual int32 await()
+        {
+            if( not isConstructed_ ) return -1;
+            return barrier_->await();
+        }
+
+        /**
+         * Returns a number of parties required to trip this barrier.
+         *
+         * @return the number of parties.
+         */
+        virtual int32 getParties() const
+        {
+            if( not isConstructed_ ) return 0;
+            return barrier_->getParties();
+        }
+
+        /**
+         * Returns a number of threads which are waiting at this barrier.
+         *
+         * @return the number of waiting threads.
+         */
+        virtual int32 getNumberWaiting() const
+        {
+            if( not isConstructed_ ) return 0;
+            return barrier_->getNumberWaiting();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @param parties a number of threads which have to arrive to trip the barrier.
+         * @return true if object has been constructed successfully.
+         */
+        bool construct(int32 parties)
+        {
+            if( not isConstructed_ ) return false;
+            barrier_ = System::call().getKernel().createBarrier(parties);
+            return barrier_ != NULL ? barrier_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        Barrier(const Barrier& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        Barrier& operator =(const Barrier& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System barrier interface.
+         */
+        ::api::Barrier* barrier_;
+
+    };
+}
+#endif // SYSTEM_BARRIER_HPP_
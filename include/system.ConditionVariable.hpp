@@ -0,0 +1,134 @@
+/**
+ * Condition variable class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_CONDITION_VARIABLE_HPP_
+#define SYSTEM_CONDITION_VARIABLE_HPP_
+
+#include "Object.hpp"
+#include "api.ConditionVariable.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class ConditionVariable : public ::Object<>, public ::api::ConditionVariable
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        ConditionVariable() : Parent(),
+            isConstructed_ (getConstruct()),
+            variable_      (NULL){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~ConditionVariable()
+        {
+            delete variable_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Waits for a notification of this condition variable.
+         *
+         * @param mutex a mutex which is locked by current thread.
+         * @return true if the thread has been notified.
+         */
+        virtual bool wait(::api::Mutex& mutex)
+        {
+            if( not isConstructed_ ) return false;
+            return variable_->wait(mutex);
+        }
+
+        /**
+         * Waits for a notification of this condition variable within given time.
+         *
+         * @param mutex   a mutex which is locked by current thread.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the thread has been notified, or false if the time has elapsed.
+         */
+        virtual bool wait(::api::Mutex& mutex, int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return variable_->wait(mutex, timeout);
+        }
+
+        /**
+         * Wakes up one thread which waits for this condition variable.
+         */
+        virtual void notifyOne()
+        {
+            if( not isConstructed_ ) return;
+            variable_->notifyOne();
+        }
+
+        /**
+         * Wakes up all threads which wait for this condition variable.
+         */
+        virtual void notifyAll()
+        {
+            if( not isConstructed_ ) return;
+            variable_->notifyAll();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            variable_ = System::call().getKernel().createConditionVariable();
+            return variable_ != NULL ? variable_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ConditionVariable(const ConditionVariable& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ConditionVariable& operator =(const ConditionVariable& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System condition variable interface.
+         */
+        ::api::ConditionVariable* variable_;
+
+    };
+}
+#endif // SYSTEM_CONDITION_VARIABLE_HPP_
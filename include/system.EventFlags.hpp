@@ -0,0 +1,189 @@
+/**
+ * Event flags class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_EVENT_FLAGS_HPP_
+#define SYSTEM_EVENT_FLAGS_HPP_
+
+#include "Object.hpp"
+#include "api.EventFlags.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class EventFlags : public ::Object<>, public ::api::EventFlags
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        EventFlags() : Parent(),
+            isConstructed_ (getConstruct()),
+            flags_         (NULL){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~EventFlags()
+        {
+            delete flags_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Sets the flags of given mask.
+         *
+         * @param mask the flags to set.
+         */
+        virtual void set(uint32 mask)
+        {
+            if( not isConstructed_ ) return;
+            flags_->set(mask);
+        }
+
+        /**
+         * Clears the flags of given mask.
+         *
+         * @param mask the flags to clear.
+         */
+        virtual void clear(uint32 mask)
+        {
+            if( not isConstructed_ ) return;
+            flags_->clear(mask);
+        }
+
+        /**
+         * Returns the current flags.
+         *
+         * @return the flags value.
+         */
+        virtual uint32 getValue() const
+        {
+            if( not isConstructed_ ) return 0;
+            return flags_->getValue();
+        }
+
+        /**
+         * Waits for any flag of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear)
+        {
+            if( not isConstructed_ ) return 0;
+            return flags_->waitAny(mask, isClear);
+        }
+
+        /**
+         * Waits for any flag of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear, int64 timeout)
+        {
+            if( not isConstructed_ ) return 0;
+            return flags_->waitAny(mask, isClear, timeout);
+        }
+
+        /**
+         * Waits for all flags of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear)
+        {
+            if( not isConstructed_ ) return 0;
+            return flags_->waitAll(mask, isClear);
+        }
+
+        /**
+         * Waits for all flags of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear, int64 timeout)
+        {
+            if( not isConstructed_ ) return 0;
+            return flags_->waitAll(mask, isClear, timeout);
+        }
+
+        /**
+         * Tests if this resource is blocked.
+         *
+         * @return true if this resource is blocked.
+         */
+        virtual bool isBlocked()
+        {
+            if( not isConstructed_ ) return false;
+            return flags_->isBlocked();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            flags_ = System::call().getKernel().createEventFlags();
+            return flags_ != NULL ? flags_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        EventFlags(const EventFlags& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        EventFlags& operator =(const EventFlags& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System event flags interface.
+         */
+        ::api::EventFlags* flags_;
+
+    };
+}
+#endif // SYSTEM_EVENT_FLAGS_HPP_
@@ -0,0 +1,214 @@
+/**
+ * Message queue class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_MESSAGE_QUEUE_HPP_
+#define SYSTEM_MESSAGE_QUEUE_HPP_
+
+#include "Object.hpp"
+#include "api.MessageQueue.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class MessageQueue : public ::Object<>, public ::api::MessageQueue
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param size     a size of messages in bytes.
+         * @param capacity a number of messages which the queue might contain.
+         */
+        MessageQueue(int32 size, int32 capacity) : Parent(),
+            isConstructed_ (getConstruct()),
+            queue_         (NULL){
+            setConstruct( construct(size, capacity) );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~MessageQueue()
+        {
+            delete queue_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Sends a message.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool send(const void* message)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->send(message);
+        }
+
+        /**
+         * Sends a message within given time.
+         *
+         * @param message a message of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been sent, or false if the time has elapsed.
+         */
+        virtual bool send(const void* message, int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->send(message, timeout);
+        }
+
+        /**
+         * Sends a message only if this queue is not full.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool trySend(const void* message)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->trySend(message);
+        }
+
+        /**
+         * Receives a message.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool receive(void* message)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->receive(message);
+        }
+
+        /**
+         * Receives a message within given time.
+         *
+         * @param message a buffer of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been received, or false if the time has elapsed.
+         */
+        virtual bool receive(void* message, int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->receive(message, timeout);
+        }
+
+        /**
+         * Receives a message only if this queue is not empty.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool tryReceive(void* message)
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->tryReceive(message);
+        }
+
+        /**
+         * Returns a size of messages.
+         *
+         * @return the message size in bytes.
+         */
+        virtual int32 getSize() const
+        {
+            if( not isConstructed_ ) return 0;
+            return queue_->getSize();
+        }
+
+        /**
+         * Returns a number of messages which this queue might contain.
+         *
+         * @return the capacity of the queue.
+         */
+        virtual int32 getCapacity() const
+        {
+            if( not isConstructed_ ) return 0;
+            return queue_->getCapacity();
+        }
+
+        /**
+         * Returns a number of messages in this queue.
+         *
+         * @return the number of messages.
+         */
+        virtual int32 getLength() const
+        {
+            if( not isConstructed_ ) return 0;
+            return queue_->getLength();
+        }
+
+        /**
+         * Tests if this resource is blocked.
+         *
+         * @return true if this resource is blocked.
+         */
+        virtual bool isBlocked()
+        {
+            if( not isConstructed_ ) return false;
+            return queue_->isBlocked();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @param size     a size of messages in bytes.
+         * @param capacity a number of messages which the queue might contain.
+         * @return true if object has been constructed successfully.
+         */
+        bool construct(int32 size, int32 capacity)
+        {
+            if( not isConstructed_ ) return false;
+            queue_ = System::call().getKernel().createMessageQueue(size, capacity);
+            return queue_ != NULL ? queue_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        MessageQueue(const MessageQueue& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        MessageQueue& operator =(const MessageQueue& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System message queue interface.
+         */
+        ::api::MessageQueue* queue_;
+
+    };
+}
+#endif // SYSTEM_MESSAGE_QUEUE_HPP_
@@ -26,7 +26,18 @@ namespace system
         Mutex() : Parent(),
             isConstructed_ (getConstruct()),
             mutex_         (NULL){
-            setConstruct( construct() ); 
+            setConstruct( construct(NULL) ); 
+        }    
+        
+        /** 
+         * Constructor of priority ceiling mutex.
+         *
+         * @param ceiling the highest priority of threads which lock the mutex.
+         */    
+        Mutex(int32 ceiling) : Parent(),
+            isConstructed_ (getConstruct()),
+            mutex_         (NULL){
+            setConstruct( construct(&ceiling) ); 
         }    
         
         /** 
@@ -58,6 +69,29 @@ namespace system
             return mutex_->lock();
         }
         
+        /**
+         * Locks the mutex within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the mutex is locked successfully, or false if the time has elapsed.
+         */      
+        virtual bool lock(int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return mutex_->lock(timeout);
+        }
+        
+        /**
+         * Locks the mutex only if it is not held by another thread.
+         *
+         * @return true if the mutex is locked successfully.
+         */      
+        virtual bool tryLock()
+        {
+            if( not isConstructed_ ) return false;
+            return mutex_->tryLock();
+        }
+        
         /**
          * Unlocks the mutex.
          */      
@@ -83,13 +117,21 @@ namespace system
         /**
          * Constructor.
          *
+         * @param ceiling the ceiling priority, or NULL for priority inheritance mutex.
          * @return true if object has been constructed successfully.   
          */
-        bool construct()
+        bool construct(int32* ceiling)
         {
             if( not isConstructed_ ) return false;
             ::api::Kernel& kernel = System::call().getKernel();
-            mutex_ = kernel.createMutex();
+            if( ceiling == NULL )
+            {
+                mutex_ = kernel.createMutex();
+            }
+            else
+            {
+                mutex_ = kernel.createMutex(*ceiling);
+            }
             return mutex_ != NULL ? mutex_->isConstructed() : false;        
         }
 
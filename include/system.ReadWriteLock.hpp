@@ -0,0 +1,177 @@
+/**
+ * Reader-writer lock class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_READ_WRITE_LOCK_HPP_
+#define SYSTEM_READ_WRITE_LOCK_HPP_
+
+#include "Object.hpp"
+#include "api.ReadWriteLock.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class ReadWriteLock : public ::Object<>, public ::api::ReadWriteLock
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        ReadWriteLock() : Parent(),
+            isConstructed_ (getConstruct()),
+            lock_          (NULL){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~ReadWriteLock()
+        {
+            delete lock_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Locks this lock for reading.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool readLock()
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->readLock();
+        }
+
+        /**
+         * Locks this lock for reading within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool readLock(int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->readLock(timeout);
+        }
+
+        /**
+         * Locks this lock for reading only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryReadLock()
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->tryReadLock();
+        }
+
+        /**
+         * Unlocks this lock held for reading.
+         */
+        virtual void readUnlock()
+        {
+            if( not isConstructed_ ) return;
+            lock_->readUnlock();
+        }
+
+        /**
+         * Locks this lock for writing.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool writeLock()
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->writeLock();
+        }
+
+        /**
+         * Locks this lock for writing within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool writeLock(int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->writeLock(timeout);
+        }
+
+        /**
+         * Locks this lock for writing only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryWriteLock()
+        {
+            if( not isConstructed_ ) return false;
+            return lock_->tryWriteLock();
+        }
+
+        /**
+         * Unlocks this lock held for writing.
+         */
+        virtual void writeUnlock()
+        {
+            if( not isConstructed_ ) return;
+            lock_->writeUnlock();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            lock_ = System::call().getKernel().createReadWriteLock();
+            return lock_ != NULL ? lock_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ReadWriteLock(const ReadWriteLock& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ReadWriteLock& operator =(const ReadWriteLock& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System reader-writer lock interface.
+         */
+        ::api::ReadWriteLock* lock_;
+
+    };
+}
+#endif // SYSTEM_READ_WRITE_LOCK_HPP_
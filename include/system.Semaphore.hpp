@@ -84,6 +84,42 @@ namespace system
             return semaphore_->acquire(permits);        
         }    
         
+        /**
+         * Acquires the given number of permits from this semaphore within given time.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the semaphore is acquired successfully, or false if the time has elapsed.
+         */  
+        virtual bool acquire(int32 permits, int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return semaphore_->acquire(permits, timeout);
+        }
+        
+        /**
+         * Acquires one permit from this semaphore only if it is available.
+         *
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire()
+        {
+            if( not isConstructed_ ) return false;
+            return semaphore_->tryAcquire();
+        }
+        
+        /**
+         * Acquires the given number of permits from this semaphore only if they are available.
+         *
+         * @param permits the number of permits to acquire.
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire(int32 permits)
+        {
+            if( not isConstructed_ ) return false;
+            return semaphore_->tryAcquire(permits);
+        }
+        
         /**
          * Releases one permit.
          */
@@ -0,0 +1,146 @@
+/** 
+ * Software interrupt resource.
+ * 
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_SOFTWARE_INTERRUPT_HPP_
+#define SYSTEM_SOFTWARE_INTERRUPT_HPP_
+
+#include "Object.hpp"
+#include "api.Task.hpp"
+#include "api.Interrupt.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class SoftwareInterrupt : public ::Object<>, public ::api::Interrupt
+    {
+        typedef ::Object<> Parent;
+  
+    public:
+
+        /** 
+         * Constructor.
+         *
+         * @param handler  user class which implements an interrupt handler interface.
+         * @param priority a priority of the interrupt in range [0, 31] where 31 is the highest.
+         */     
+        SoftwareInterrupt(::api::Task& handler, int32 priority) : Parent(),
+            isConstructed_ (getConstruct()),
+            interrupt_     (NULL){
+            setConstruct( construct(handler, priority) );
+        }
+        
+        /** 
+         * Destructor.
+         */
+        virtual ~SoftwareInterrupt()
+        {
+            delete interrupt_;
+        }
+        
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */    
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+        
+        /**
+         * Posts this interrupt and runs the pending interrupts.
+         */      
+        virtual void jump()
+        {
+            if( not isConstructed_ ) return;
+            interrupt_->jump();
+        }
+        
+        /**
+         * Cancels a posting of this interrupt.
+         */     
+        virtual void clear()
+        {
+            if( not isConstructed_ ) return;
+            interrupt_->clear();  
+        }        
+        
+        /**
+         * Posts this interrupt.
+         */    
+        virtual void set()
+        {
+            if( not isConstructed_ ) return;
+            interrupt_->set();  
+        }          
+        
+        /**
+         * Locks this interrupt.
+         *
+         * @return an interrupt enable bit value before method was called.
+         */    
+        virtual bool disable()
+        {
+            if( not isConstructed_ ) return false;  
+            return interrupt_->disable();
+        }
+        
+        /**
+         * Unlocks this interrupt.
+         *
+         * @param status returned status by lock method.
+         */
+        virtual void enable(bool status)
+        {
+            if( not isConstructed_ ) return;
+            interrupt_->enable(status);  
+        }
+  
+    private:
+      
+        /**
+         * Constructor.
+         *
+         * @param handler  user class which implements an interrupt handler interface.
+         * @param priority a priority of the interrupt in range [0, 31] where 31 is the highest.
+         * @return true if object has been constructed successfully.     
+         */    
+        bool construct(::api::Task& handler, int32 priority)
+        {
+            if( not isConstructed_ ) return false;    
+            interrupt_ = System::call().getKernel().createSoftwareInterrupt(handler, priority);
+            return interrupt_ != NULL ? interrupt_->isConstructed() : false;
+        }        
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SoftwareInterrupt(const SoftwareInterrupt& obj);
+      
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.     
+         */
+        SoftwareInterrupt& operator =(const SoftwareInterrupt& obj);
+        
+        /** 
+         * The root object constructed flag.
+         */  
+        const bool& isConstructed_;    
+      
+        /**
+         * System interrupt controller interface.
+         */    
+        ::api::Interrupt* interrupt_;
+  
+    };
+}
+#endif // SYSTEM_SOFTWARE_INTERRUPT_HPP_
@@ -0,0 +1,140 @@
+/**
+ * Software timer class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef SYSTEM_SOFTWARE_TIMER_HPP_
+#define SYSTEM_SOFTWARE_TIMER_HPP_
+
+#include "Object.hpp"
+#include "api.Task.hpp"
+#include "api.SoftwareTimer.hpp"
+#include "system.System.hpp"
+
+namespace system
+{
+    class SoftwareTimer : public ::Object<>, public ::api::SoftwareTimer
+    {
+        typedef ::Object<> Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param handler user class which implements a timer handler interface.
+         */
+        SoftwareTimer(::api::Task& handler) : Parent(),
+            isConstructed_ (getConstruct()),
+            timer_         (NULL){
+            setConstruct( construct(handler) );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~SoftwareTimer()
+        {
+            delete timer_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Starts this timer for one expiration.
+         *
+         * @param delay the time to expiration in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay)
+        {
+            if( not isConstructed_ ) return false;
+            return timer_->start(delay);
+        }
+
+        /**
+         * Starts this timer for periodic expirations.
+         *
+         * @param delay  the time to first expiration in nanoseconds.
+         * @param period the time between expirations in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay, int64 period)
+        {
+            if( not isConstructed_ ) return false;
+            return timer_->start(delay, period);
+        }
+
+        /**
+         * Stops this timer.
+         */
+        virtual void stop()
+        {
+            if( not isConstructed_ ) return;
+            timer_->stop();
+        }
+
+        /**
+         * Tests if this timer is started.
+         *
+         * @return true if this timer waits for an expiration.
+         */
+        virtual bool isActive() const
+        {
+            if( not isConstructed_ ) return false;
+            return timer_->isActive();
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @param handler user class which implements a timer handler interface.
+         * @return true if object has been constructed successfully.
+         */
+        bool construct(::api::Task& handler)
+        {
+            if( not isConstructed_ ) return false;
+            timer_ = System::call().getKernel().createSoftwareTimer(handler);
+            return timer_ != NULL ? timer_->isConstructed() : false;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SoftwareTimer(const SoftwareTimer& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SoftwareTimer& operator =(const SoftwareTimer& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * System software timer interface.
+         */
+        ::api::SoftwareTimer* timer_;
+
+    };
+}
+#endif // SYSTEM_SOFTWARE_TIMER_HPP_
@@ -40,6 +40,33 @@ namespace system
             setConstruct( construct(task) );
         }
         
+        /** 
+         * Constructor of earliest deadline first thread.
+         *
+         * @param period   the thread period in nanoseconds.
+         * @param budget   the thread execution time in each period in nanoseconds.
+         * @param deadline the relative deadline of each period in nanoseconds.
+         */
+        Thread(int64 period, int64 budget, int64 deadline) : Parent(),
+            isConstructed_ (getConstruct()),
+            thread_        (NULL){
+            setConstruct( construct(*this, period, budget, deadline) );
+        }
+        
+        /** 
+         * Constructor of earliest deadline first thread.
+         *
+         * @param task     an task interface whose main method is invoked when this thread is started.
+         * @param period   the thread period in nanoseconds.
+         * @param budget   the thread execution time in each period in nanoseconds.
+         * @param deadline the relative deadline of each period in nanoseconds.
+         */
+        Thread(::api::Task& task, int64 period, int64 budget, int64 deadline) : Parent(),
+            isConstructed_ (getConstruct()),
+            thread_        (NULL){
+            setConstruct( construct(task, period, budget, deadline) );
+        }
+        
         /** 
          * Destructor.
          */
@@ -92,6 +119,18 @@ namespace system
             if( not isConstructed_ ) return; 
             return thread_->join();
         }
+        
+        /**
+         * Waits for this thread to die within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this thread has died, or false if the time has elapsed.
+         */  
+        virtual bool join(int64 timeout)
+        {
+            if( not isConstructed_ ) return false;
+            return thread_->join(timeout);
+        }
       
         /**
          * Causes this thread to sleep.
@@ -116,6 +155,69 @@ namespace system
             return thread_->block(res);    
         }
         
+        /**
+         * Blocks this thread on given resources till any of them is not blocked.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @return an index of the first resource which is not blocked, or -1 if error has been occurred.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count)
+        {
+            if( not isConstructed_ ) return -1; 
+            return thread_->block(resources, count);    
+        }
+        
+        /**
+         * Blocks this thread on given resources till any of them is not blocked or given time elapses.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @param timeout   the maximum time to wait in nanoseconds.
+         * @return an index of the first resource which is not blocked, or -1 if the time has elapsed.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count, int64 timeout)
+        {
+            if( not isConstructed_ ) return -1; 
+            return thread_->block(resources, count, timeout);    
+        }
+        
+        /**
+         * Sets notification bits of this thread.
+         *
+         * @param bits the bits to set.
+         */  
+        virtual void notify(uint32 bits)
+        {
+            if( not isConstructed_ ) return; 
+            thread_->notify(bits);    
+        }
+        
+        /**
+         * Waits for any notification bit of given mask.
+         *
+         * @param mask the bits to wait for.
+         * @return the notification bits of the mask, or zero if error has been occurred.
+         */  
+        virtual uint32 waitNotification(uint32 mask)
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->waitNotification(mask);    
+        }
+        
+        /**
+         * Waits for any notification bit of given mask within given time.
+         *
+         * @param mask    the bits to wait for.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the notification bits of the mask, or zero if the time has elapsed.
+         */  
+        virtual uint32 waitNotification(uint32 mask, int64 timeout)
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->waitNotification(mask, timeout);    
+        }
+        
         /**
          * Returns the identifier of this thread.
          *
@@ -160,6 +262,92 @@ namespace system
             return thread_->setPriority(priority);
         }
       
+        /**
+         * Sets this thread period.
+         *
+         * @param nanos the period in nanoseconds, or zero to reset periodic mode.
+         */  
+        virtual void setPeriod(int64 nanos)
+        {
+            if( not isConstructed_ ) return; 
+            return thread_->setPeriod(nanos);
+        }
+        
+        /**
+         * Causes this thread to wait for the beginning of next period.
+         */  
+        virtual void waitNextPeriod()
+        {
+            if( not isConstructed_ ) return; 
+            return thread_->waitNextPeriod();
+        }
+        
+        /**
+         * Returns a number of periods which this thread has overrun.
+         *
+         * @return number of overruns.
+         */  
+        virtual int32 getOverrunCount() const
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->getOverrunCount();
+        }
+        
+        /**
+         * Returns a number of deadlines which this thread has missed.
+         *
+         * @return number of deadline misses.
+         */  
+        virtual int32 getMissCount() const
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->getMissCount();
+        }
+        
+        /**
+         * Returns the processor time which this thread has been executed.
+         *
+         * @return time in nanoseconds.
+         */  
+        virtual int64 getRunTime() const
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->getRunTime();
+        }
+        
+        /**
+         * Returns the time when this thread has been switched to last time.
+         *
+         * @return time in nanoseconds, or -1 if the thread has never been executed.
+         */  
+        virtual int64 getDispatchTime() const
+        {
+            if( not isConstructed_ ) return -1; 
+            return thread_->getDispatchTime();
+        }
+        
+        /**
+         * Returns a number of switches from this thread which the thread has caused itself.
+         *
+         * @return number of voluntary switches.
+         */  
+        virtual int64 getVoluntarySwitchCount() const
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->getVoluntarySwitchCount();
+        }
+        
+        /**
+         * Returns a number of switches from this thread which have preempted the thread.
+         *
+         * @return number of involuntary switches.
+         */  
+        virtual int64 getInvoluntarySwitchCount() const
+        {
+            if( not isConstructed_ ) return 0; 
+            return thread_->getInvoluntarySwitchCount();
+        }
+      
         /**
          * Returns currently executing thread.
          *
@@ -214,6 +402,23 @@ namespace system
             if( thread_ == NULL || not thread_->isConstructed() ) return false; 
             return true;
         }        
+        
+        /**
+         * Constructor.
+         *
+         * @param task     an task interface whose main method is invoked when this thread is started.     
+         * @param period   the thread period in nanoseconds.
+         * @param budget   the thread execution time in each period in nanoseconds.
+         * @param deadline the relative deadline of each period in nanoseconds.
+         * @return true if object has been constructed successfully.   
+         */
+        bool construct(::api::Task& task, int64 period, int64 budget, int64 deadline)
+        {
+            if( not isConstructed_ ) return false; 
+            thread_ = System::call().getKernel().getScheduler().createThread(task, period, budget, deadline);
+            if( thread_ == NULL || not thread_->isConstructed() ) return false; 
+            return true;
+        }        
                 
         /**
          * Copy constructor.
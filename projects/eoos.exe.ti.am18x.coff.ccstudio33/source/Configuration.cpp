@@ -15,5 +15,6 @@ Configuration::Configuration() :
     cpuClock    (375000000),
     heapAddr    (reinterpret_cast<void*>(0xffff0100)),
     heapSize    (0x00001f00),
-    stackSize   (0x00000800){    
+    stackSize   (0x00000800),
+    swiSource   (26){    
 }
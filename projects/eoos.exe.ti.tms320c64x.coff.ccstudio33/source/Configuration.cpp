@@ -15,5 +15,6 @@ Configuration::Configuration() :
     cpuClock    (720000000),
     heapAddr    (reinterpret_cast<void*>(0x00031000)),
     heapSize    (0x0000f000),
-    stackSize   (0x00000800){    
+    stackSize   (0x00000800),
+    swiSource   (0x1f){    
 }
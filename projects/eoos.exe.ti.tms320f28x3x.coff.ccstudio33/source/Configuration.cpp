@@ -15,5 +15,6 @@ Configuration::Configuration() :
     cpuClock    (150000000),
     heapAddr    (reinterpret_cast<void*>(0x0000f000)),
     heapSize    (0x00001000),
-    stackSize   (0x00000800){    
+    stackSize   (0x00000800),
+    swiSource   (0x021c){    
 }
@@ -0,0 +1,171 @@
+/**
+ * Cyclic barrier class.
+ *
+ * Arriving threads are parked on the queue of the barrier, and the last arriving
+ * thread wakes all of them while the scheduler is locked, so the woken threads
+ * are switched in one pass of the scheduler when the last thread unlocks it.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_BARRIER_HPP_
+#define KERNEL_BARRIER_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.Barrier.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.SchedulerThread.hpp"
+
+namespace kernel
+{
+    class Barrier : public ::kernel::Object, public ::api::Barrier
+    {
+        typedef ::kernel::Object Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param parties a number of threads which have to arrive to trip the barrier.
+         */
+        Barrier(int32 parties) : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            thread_        (NULL),
+            parties_       (parties),
+            count_         (0),
+            fifo_          (){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~Barrier()
+        {
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Waits till all parties have called this method.
+         *
+         * @return the arrival index, or -1 if error has been occurred.
+         */
+        virtual int32 await()
+        {
+            if( not isConstructed_ ) return -1;
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return -1;
+            bool is = thread_->disable();
+            count_++;
+            int32 index = parties_ - count_;
+            if(count_ == parties_)
+            {
+                // The barrier is reset before the waiting threads are switched to
+                count_ = 0;
+                while( not fifo_.isEmpty() ) scheduler_->wakeThread( *fifo_.peek() );
+            }
+            else
+            {
+                ThreadQueue::Node node(*thread);
+                fifo_.add(node);
+                thread->wait();
+            }
+            return thread_->enable(is, index);
+        }
+
+        /**
+         * Returns a number of parties required to trip this barrier.
+         *
+         * @return the number of parties.
+         */
+        virtual int32 getParties() const
+        {
+            return isConstructed_ ? parties_ : 0;
+        }
+
+        /**
+         * Returns a number of threads which are waiting at this barrier.
+         *
+         * @return the number of waiting threads.
+         */
+        virtual int32 getNumberWaiting() const
+        {
+            return isConstructed_ ? count_ : 0;
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            if(parties_ <= 0) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
+            thread_ = &scheduler_->toggle();
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        Barrier(const Barrier& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        Barrier& operator =(const Barrier& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The kernel threads scheduler.
+         */
+        ::kernel::Scheduler* scheduler_;
+
+        /**
+         * The kernel threads switching toggle.
+         */
+        ::api::Toggle* thread_;
+
+        /**
+         * Number of threads which have to arrive to trip this barrier.
+         */
+        int32 parties_;
+
+        /**
+         * Number of threads which have arrived in current cycle.
+         */
+        int32 count_;
+
+        /**
+         * Queue of waiting threads.
+         */
+        ThreadQueue fifo_;
+
+    };
+}
+#endif // KERNEL_BARRIER_HPP_
@@ -0,0 +1,196 @@
+/**
+ * Condition variable class.
+ *
+ * A waiting thread unlocks the mutex and is parked on the queue of the variable
+ * while the scheduler is locked, so no notification is lost between them.
+ * Notified threads are woken up in order of waiting directly by the scheduler.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_CONDITION_VARIABLE_HPP_
+#define KERNEL_CONDITION_VARIABLE_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.ConditionVariable.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.SchedulerThread.hpp"
+
+namespace kernel
+{
+    class ConditionVariable : public ::kernel::Object, public ::api::ConditionVariable
+    {
+        typedef ::kernel::Object Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        ConditionVariable() : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            thread_        (NULL),
+            fifo_          (){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~ConditionVariable()
+        {
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Waits for a notification of this condition variable.
+         *
+         * @param mutex a mutex which is locked by current thread.
+         * @return true if the thread has been notified.
+         */
+        virtual bool wait(::api::Mutex& mutex)
+        {
+            return wait(mutex, 0, false);
+        }
+
+        /**
+         * Waits for a notification of this condition variable within given time.
+         *
+         * @param mutex   a mutex which is locked by current thread.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the thread has been notified, or false if the time has elapsed.
+         */
+        virtual bool wait(::api::Mutex& mutex, int64 timeout)
+        {
+            return wait(mutex, timeout, true);
+        }
+
+        /**
+         * Wakes up one thread which waits for this condition variable.
+         */
+        virtual void notifyOne()
+        {
+            if( not isConstructed_ ) return;
+            bool is = thread_->disable();
+            // The thread which has been timed out is skipped
+            ThreadQueue::Node* node = fifo_.peek();
+            while(node != NULL)
+            {
+                if( scheduler_->wakeThread(*node) ) break;
+                node = fifo_.peek();
+            }
+            thread_->enable(is);
+        }
+
+        /**
+         * Wakes up all threads which wait for this condition variable.
+         */
+        virtual void notifyAll()
+        {
+            if( not isConstructed_ ) return;
+            bool is = thread_->disable();
+            while( not fifo_.isEmpty() ) scheduler_->wakeThread( *fifo_.peek() );
+            thread_->enable(is);
+        }
+
+    private:
+
+        /**
+         * Waits for a notification of this condition variable.
+         *
+         * @param mutex   a mutex which is locked by current thread.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the thread has been notified.
+         */
+        bool wait(::api::Mutex& mutex, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return false;
+            bool is = thread_->disable();
+            // Park the thread before unlocking, as a notifying thread is not executed till the thread yields
+            ThreadQueue::Node node(*thread);
+            fifo_.add(node);
+            mutex.unlock();
+            bool res = true;
+            if( not isTimed )
+            {
+                thread->wait();
+            }
+            else if( timeout > 0 )
+            {
+                res = thread->wait(timeout);
+            }
+            else
+            {
+                res = false;
+            }
+            fifo_.remove(node);
+            thread_->enable(is);
+            mutex.lock();
+            return res;
+        }
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
+            thread_ = &scheduler_->toggle();
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ConditionVariable(const ConditionVariable& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ConditionVariable& operator =(const ConditionVariable& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The kernel threads scheduler.
+         */
+        ::kernel::Scheduler* scheduler_;
+
+        /**
+         * The kernel threads switching toggle.
+         */
+        ::api::Toggle* thread_;
+
+        /**
+         * Queue of waiting threads.
+         */
+        ThreadQueue fifo_;
+
+    };
+}
+#endif // KERNEL_CONDITION_VARIABLE_HPP_
@@ -1,6 +1,16 @@
 /**
  * Escalator class.
- * 
+ *
+ * The escalator is a semaphore of threads which is guarded by the scheduler lock
+ * instead of masking interrupts, so it must not be used in an interrupt context.
+ * Waiting threads are parked on a queue and the permits are handed over to them 
+ * directly by a releasing thread. Threads pass the fair escalator in order of 
+ * arriving, as a thread does not acquire permits while other threads wait for them.
+ *
+ * The fair escalator orders entering only, and threads leave it in any order. 
+ * A releasing thread does not wait for threads which have entered before it,
+ * as it did when the escalator kept a list of entered threads.
+ *
  * @author    Sergey Baigudin, sergey@baigudin.software
  * @copyright 2017, Embedded Team, Sergey Baigudin
  * @license   http://embedded.team/license/
@@ -10,426 +20,298 @@
 
 #include "kernel.Object.hpp"
 #include "api.Semaphore.hpp"
-#include "api.Thread.hpp"
 #include "kernel.Kernel.hpp"
-#include "library.LinkedList.hpp"
+#include "kernel.SchedulerThread.hpp"
 
 namespace kernel
 {
     class Escalator : public ::kernel::Object, public ::api::Semaphore
     {
         typedef ::kernel::Object Parent;
-     
+
     public:
-  
-        /** 
+
+        /**
          * Constructor.
          *
-         * @param permits the initial number of permits available.   
-         */      
+         * @param permits the initial number of permits available.
+         */
         Escalator(int32 permits) : Parent(),
-            isConstructed_ (getConstruct()),        
+            isConstructed_ (getConstruct()),
             scheduler_     (NULL),
-            thread_        (NULL),                    
-            permits_ (permits),
-            isFair_  (false),
-            list_    (){
-            setConstruct( construct() );  
+            permits_       (permits),
+            isFair_        (false),
+            fifo_          (),
+            observers_     (){
+            setConstruct( construct() );
         }
-        
-        /** 
+
+        /**
          * Constructor.
          *
-         * @param permits the initial number of permits available.      
-         * @param fair true if this escalator will guarantee FIFO granting of permits under contention.
-         */      
+         * @param permits the initial number of permits available.
+         * @param fair    true if this escalator will guarantee FIFO granting of permits under contention.
+         */
         Escalator(int32 permits, bool fair) : Parent(),
-            isConstructed_ (getConstruct()),        
+            isConstructed_ (getConstruct()),
             scheduler_     (NULL),
-            thread_        (NULL),           
-            permits_ (permits),
-            isFair_  (fair),
-            list_    (){
-            setConstruct( construct() );  
+            permits_       (permits),
+            isFair_        (fair),
+            fifo_          (),
+            observers_     (){
+            setConstruct( construct() );
         }
-                                
-        /** 
+
+        /**
          * Destructor.
          */
         virtual ~Escalator()
         {
         }
-        
+
         /**
          * Tests if this object has been constructed.
          *
          * @return true if object has been constructed successfully.
-         */    
+         */
         virtual bool isConstructed() const
         {
-            return this->Parent::isConstructed();
+            return isConstructed_;
         }
-        
+
         /**
          * Acquires one permit from this escalator.
          *
          * @return true if the escalator is acquired successfully.
-         */  
+         */
         virtual bool acquire()
         {
             return acquire(1);
         }
-        
+
         /**
          * Acquires the given number of permits from this escalator.
          *
          * @param permits the number of permits to acquire.
          * @return true if the escalator is acquired successfully.
-         */  
+         */
         virtual bool acquire(int32 permits)
         {
-            bool res, is;  
-            if(!isConstructed()) return false;
-            is = thread_->disable();
-            ::api::Thread& thread = scheduler_->getCurrentThread();
-            Node node(thread, permits);
-            // Check about available space in the semaphoring critical section
-            if( permits_ - permits >= 0 && list_.lock.isEmpty() )
-            {
-                // Add current thread to the executing queue
-                res = isFair_ ? list_.exec.add(node) : true;
-                // Decrement the number of available permits
-                if(res == true) permits_ -= permits;
-                // Go through the escalator to critical section
-                return thread_->enable(is, res);      
-            }
-            // Add current thread to the locking queue
-            res = list_.lock.add(node);
-            if(res == true)
-            {
-                // Block current thread on the escalator and switch to another thread
-                thread.block(*this);
-                // This thread is unblocked by the scheduler called isBlocked method 
-                res = removeNode(list_.lock, node);
-            }
-            // Go through the escalator to critical section
-            return thread_->enable(is, res);      
+            return acquire(permits, 0, false);
+        }
+
+        /**
+         * Acquires the given number of permits from this escalator within given time.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the escalator is acquired successfully, or false if the time has elapsed.
+         */
+        virtual bool acquire(int32 permits, int64 timeout)
+        {
+            return acquire(permits, timeout, true);
         }
-        
+
+        /**
+         * Acquires one permit from this escalator only if it is available.
+         *
+         * @return true if the escalator is acquired successfully.
+         */
+        virtual bool tryAcquire()
+        {
+            return acquire(1, 0, true);
+        }
+
+        /**
+         * Acquires the given number of permits from this escalator only if they are available.
+         *
+         * @param permits the number of permits to acquire.
+         * @return true if the escalator is acquired successfully.
+         */
+        virtual bool tryAcquire(int32 permits)
+        {
+            return acquire(permits, 0, true);
+        }
+
         /**
          * Releases one permit.
          */
         virtual void release()
         {
             release(1);
-        }    
-        
+        }
+
         /**
          * Releases the given number of permits.
          *
          * @param permits the number of permits to release.
-         */  
+         */
         virtual void release(int32 permits)
         {
-            bool res, is;
-            if(!isConstructed()) return;
-            is = thread_->disable();
-            Node node(scheduler_->getCurrentThread(), permits);
-            // Remove current thread from executing list    
-            res = isFair_ ? removeNode(list_.exec, node) : true;
-            // Increment the number of available permits    
-            if(res == true) permits_ += permits;
-            // Signal the escalator has released permits
-            thread_->enable(is);
+            if( not isConstructed_ ) return;
+            scheduler_->lock();
+            permits_ += permits;
+            handOver();
+            scheduler_->unlock();
         }
-        
+
         /**
          * Tests if this escalator is fair.
          *
          * @return true if this escalator has fairness set true.
-         */  
+         */
         virtual bool isFair() const
         {
             return isFair_;
         }
-        
-        /** 
+
+        /**
          * Tests if this resource is blocked.
          *
          * @return true if this resource is blocked.
-         */ 
+         */
         virtual bool isBlocked()
         {
-            if(!isConstructed()) return false;
-            bool is = thread_->disable();
-            Node cur(scheduler_->getCurrentThread(), 0);
-            Node res = list_.lock.peek();
-            // Test if current thread is the first in FIFO
-            if(cur != res) return thread_->enable(is, true);
-            // Check about free permits of escalator
-            if(permits_ - res.permits < 0) return thread_->enable(is, true);
-            // Unblock thread
-            permits_ -= res.permits;
-            if(isFair_ == true) list_.exec.add( Node(scheduler_->getCurrentThread(), res.permits) );
-            return thread_->enable(is, false);    
-        }        
-  
+            if( not isConstructed_ ) return false;
+            scheduler_->lock();
+            // A thread which waits for several resources is notified of released permits
+            scheduler_->observe(observers_);
+            bool res = permits_ > 0 && (not isFair_ || fifo_.isEmpty()) ? false : true;
+            scheduler_->unlock();
+            return res;
+        }
+
     private:
-    
-        /** 
-         * Node for escalator lists.
-         */  
-        class Node
+
+        /**
+         * Acquires the given number of permits from this escalator.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the escalator is acquired successfully.
+         */
+        bool acquire(int32 permits, int64 timeout, bool isTimed)
         {
-        
-        public:
-        
-            /** 
-             * Constructor.
-             *
-             * @param ipermits number of permits to release.
-             * @param thread   current executing thread.
-             * @return true if the escalator is release successfully.
-             */
-            Node(::api::Thread& thread, int32 ipermits) :
-                permits (ipermits),
-                thread_ (&thread){
+            if( not isConstructed_ ) return false;
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return false;
+            scheduler_->lock();
+            // A thread does not pass the threads which wait on the fair escalator
+            if( permits_ - permits >= 0 && (not isFair_ || fifo_.isEmpty()) )
+            {
+                permits_ -= permits;
+                scheduler_->unlock();
+                return true;
             }
-          
-            /** 
-             * Copy constructor.
-             *
-             * @param obj reference to source node.       
-             */    
-            Node(const Node& obj) :
-                permits (obj.permits),
-                thread_ (obj.thread_){
+            if( isTimed && timeout <= 0 )
+            {
+                scheduler_->unlock();
+                return false;
             }
-            
-            /** 
-             * Constructor.
-             *
-             * Constructs this object as illegal.
-             *
-             * @param ipermits number of permits to release.
-             * @return true if the escalator is release successfully.
-             */
-            Node(int32 ipermits) :
-                permits (ipermits),
-                thread_ (NULL){
-            }      
-          
-            /**
-             * Destructor.
-             */
-           ~Node(){}
-          
-            /** 
-             * Assignment operator.
-             *
-             * @param node reference to source node.
-             * @return reference to this object.
-             */  
-            Node& operator =(const Node& node)
+            // The permits are handed over by a releasing thread before it wakes this one
+            ThreadQueue::Node node(*thread);
+            node.value = permits;
+            fifo_.add(node);
+            if( not isTimed )
             {
-                thread_ = node.thread_;
-                permits = node.permits;
-                return *this;
+                thread->wait();
+                scheduler_->unlock();
+                return true;
             }
-            
-            /**
-             * Equality operator.
-             *
-             * @param obj1 reference first object.
-             * @param obj2 reference second object.
-             * @return true if object are equal.
-             */
-            friend bool operator ==(const Node& obj1, const Node& obj2);
-            
-            /**
-             * Inequality operator.
-             *
-             * @param obj1 reference first object.
-             * @param obj2 reference second object.
-             * @return true if object are not equal.
-             */      
-            friend bool operator !=(const Node& obj1, const Node& obj2);
-          
-            /** 
-             * Number of permits to release for this thread.
-             */
-            int32 permits;
-          
-        private:
-        
-            /** 
-             * Executing thread.
-             */
-            ::api::Thread* thread_;
-        
-        };
-        
-        /** 
-         * Contain lists for the escalator.
-         */  
-        class List
-        {
-        
-        public:
-        
-            /** 
-             * Constructor.
-             */
-            List() : 
-                illegal_ (-1),
-                exec     (illegal_), 
-                lock     (illegal_){
+            bool res = thread->wait(timeout);
+            if( not res )
+            {
+                // The timed out thread might have kept the next threads waiting
+                fifo_.remove(node);
+                handOver();
             }
-          
-            /**
-             * Destructor.
-             */
-           ~List(){}
-            
-            /**
-             * Tests if this object has been constructed.
-             *
-             * @return true if object has been constructed successfully.
-             */    
-            bool isConstructed() const
+            scheduler_->unlock();
+            return res;
+        }
+
+        /**
+         * Hands available permits over to waiting threads.
+         */
+        void handOver()
+        {
+            ThreadQueue::Node* node = fifo_.peek();
+            while(node != NULL)
             {
-                if(!exec.isConstructed()) return false;
-                if(!lock.isConstructed()) return false;        
-                return true;
+                ThreadQueue::Node* next = node->getNext() != fifo_.peek() ? node->getNext() : NULL;
+                if( permits_ - node->value >= 0 )
+                {
+                    int32 value = node->value;
+                    if( scheduler_->wakeThread(*node) ) permits_ -= value;
+                }
+                // The fair escalator does not break the FIFO order
+                else if(isFair_)
+                {
+                    break;
+                }
+                node = next;
             }
-        
-        private:
-        
-            /**
-             * Illegal value for all this lists.
-             */
-            Node illegal_;
-        
-        public:
-          
-            /**
-             * List of executing threads for fair escalator.
-             *
-             * ::api::Queue interface of the list is only used by the escalator.
-             */      
-            library::LinkedList<Node> exec;
-            
-            /**
-             * List of locked threads.
-             *
-             * ::api::Queue interface of the list is only used by the escalator.
-             */      
-            library::LinkedList<Node> lock;
-         
-        };
-        
+            // The threads which wait for several resources test the permits again
+            if(permits_ > 0) scheduler_->notifyObservers(observers_);
+        }
+
         /**
          * Constructor.
          *
-         * @return true if object has been constructed successfully.     
-         */    
+         * @return true if object has been constructed successfully.
+         */
         bool construct()
         {
-            if(!isConstructed()) return false;      
-            if(!list_.isConstructed()) return false;      
-            scheduler_ = &Kernel::call().getScheduler();
-            thread_ = &scheduler_->toggle();            
+            if( not isConstructed_ ) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
             return true;
-        }        
-        
-        /**
-         * Removes last element from list.
-         *
-         * @param list reference to a queue.
-         * @param node reference to node.     
-         */    
-        bool removeNode(::api::Queue<Node>& list, Node& node)
-        {
-            while(true)
-            {
-                // Remove the head thread if it given thread of the node
-                if(list.peek() == node) return list.remove();
-                 scheduler_->yield();
-            }      
-        }         
-        
+        }
+
         /**
          * Copy constructor.
          *
          * @param obj reference to source object.
          */
         Escalator(const Escalator& obj);
-        
+
         /**
          * Assignment operator.
          *
          * @param obj reference to source object.
          * @return reference to this object.
          */
-        Escalator& operator =(const Escalator& obj);     
-        
-        /** 
+        Escalator& operator =(const Escalator& obj);
+
+        /**
          * The root object constructed flag.
-         */  
+         */
         const bool& isConstructed_;
 
         /**
          * The kernel threads scheduler.
-         */        
-        ::api::Scheduler* scheduler_;
-        
-        /**
-         * The kernel threads switching toggle.
-         */        
-        ::api::Toggle* thread_;        
-        
+         */
+        ::kernel::Scheduler* scheduler_;
+
         /**
          * Number of permits for acquiring this escalator.
          */
         int32 permits_;
-        
+
         /**
          * Escalator fair flag.
-         */    
+         */
         bool isFair_;
-        
-        /** 
-         * Lists of this escalator.
-         */     
-        List list_;
-        
-        friend bool operator ==(const Node& node1, const Node& node2);
-        friend bool operator !=(const Node& node1, const Node& node2);    
+
+        /**
+         * Queue of waiting threads.
+         */
+        ThreadQueue fifo_;
+
+        /**
+         * Queue of threads which wait for any of several resources.
+         */
+        ThreadQueue observers_;
+
     };
-    
-    /**
-     * Equality operator.
-     *
-     * @param obj1 reference first object.
-     * @param obj2 reference second object.
-     * @return true if object are equal.
-     */
-    inline bool operator ==(const Escalator::Node& obj1, const Escalator::Node& obj2)
-    {
-        return obj1.thread_ == obj2.thread_ ? true : false;
-    }
-    
-    /**
-     * Inequality operator.
-     *
-     * @param obj1 reference first object.
-     * @param obj2 reference second object.
-     * @return true if object are not equal.
-     */      
-    inline bool operator !=(const Escalator::Node& obj1, const Escalator::Node& obj2)
-    {
-        return obj1.thread_ != obj2.thread_ ? true : false;
-    }
-    
 }
 #endif // KERNEL_ESCALATOR_HPP_
@@ -0,0 +1,339 @@
+/**
+ * Event flags class.
+ *
+ * A group of 32 flags which are set by interrupts or threads, and waited by threads
+ * for any or all flags of a mask. Waiting threads are checked and woken up directly
+ * by setting the flags, and as a resource the flags are blocked while no flag is set.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_EVENT_FLAGS_HPP_
+#define KERNEL_EVENT_FLAGS_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.EventFlags.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.SchedulerThread.hpp"
+#include "module.Interrupt.hpp"
+
+namespace kernel
+{
+    class EventFlags : public ::kernel::Object, public ::api::EventFlags
+    {
+        typedef ::kernel::Object    Parent;
+        typedef ::module::Interrupt Int;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        EventFlags() : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            flags_         (0),
+            fifo_          (),
+            observers_     (){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~EventFlags()
+        {
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Sets the flags of given mask.
+         *
+         * The method is called in interrupt contexts, so all the waiting threads are 
+         * tested and woken up in one section of disabled interrupts, and the time of 
+         * the section grows linearly with the number of waiting threads. Thus, the 
+         * flags which are set by interrupts should be waited by a few threads.
+         *
+         * @param mask the flags to set.
+         */
+        virtual void set(uint32 mask)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            flags_ |= mask;
+            // Wake up the threads which waiting is complete in order of waiting
+            ThreadQueue::Node* node = fifo_.peek();
+            while(node != NULL)
+            {
+                ThreadQueue::Node* next = node->getNext() != fifo_.peek() ? node->getNext() : NULL;
+                Waiter& waiter = static_cast<Waiter&>(*node);
+                if( isComplete(waiter.mask, waiter.isAll) )
+                {
+                    waiter.result = flags_;
+                    if( scheduler_->wakeThread(waiter) && waiter.isClear ) flags_ &= ~waiter.mask;
+                }
+                node = next;
+            }
+            bool isSet = flags_ != 0 ? true : false;
+            Int::enableAll(is);
+            // The threads which wait for several resources test the flags again
+            if(isSet) scheduler_->notifyObservers(observers_);
+        }
+
+        /**
+         * Clears the flags of given mask.
+         *
+         * @param mask the flags to clear.
+         */
+        virtual void clear(uint32 mask)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            flags_ &= ~mask;
+            Int::enableAll(is);
+        }
+
+        /**
+         * Returns the current flags.
+         *
+         * @return the flags value.
+         */
+        virtual uint32 getValue() const
+        {
+            return isConstructed_ ? flags_ : 0;
+        }
+
+        /**
+         * Waits for any flag of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear)
+        {
+            return wait(mask, false, isClear, 0, false);
+        }
+
+        /**
+         * Waits for any flag of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAny(uint32 mask, bool isClear, int64 timeout)
+        {
+            return wait(mask, false, isClear, timeout, true);
+        }
+
+        /**
+         * Waits for all flags of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @return the flags value which has completed the waiting, or zero if error has been occurred.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear)
+        {
+            return wait(mask, true, isClear, 0, false);
+        }
+
+        /**
+         * Waits for all flags of given mask within given time.
+         *
+         * @param mask    the flags to wait for.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the flags value which has completed the waiting, or zero if the time has elapsed.
+         */
+        virtual uint32 waitAll(uint32 mask, bool isClear, int64 timeout)
+        {
+            return wait(mask, true, isClear, timeout, true);
+        }
+
+        /**
+         * Tests if this resource is blocked.
+         *
+         * @return true if no flag is set.
+         */
+        virtual bool isBlocked()
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            // A thread which waits for several resources is notified of set flags
+            scheduler_->observe(observers_);
+            bool res = flags_ == 0 ? true : false;
+            return Int::enableAll(is, res);
+        }
+
+    private:
+
+        /**
+         * Node of a waiting thread.
+         */
+        class Waiter : public ThreadQueue::Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param thread   a waiting thread.
+             * @param imask    the flags to wait for.
+             * @param iisAll   true if all flags of the mask are waited.
+             * @param iisClear true if the flags of the mask are cleared when the waiting is complete.
+             */
+            Waiter(SchedulerThread& thread, uint32 imask, bool iisAll, bool iisClear) : ThreadQueue::Node(thread),
+                mask    (imask),
+                isAll   (iisAll),
+                isClear (iisClear),
+                result  (0){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Waiter(){}
+
+            /**
+             * The flags to wait for.
+             */
+            uint32 mask;
+
+            /**
+             * All flags of the mask are waited.
+             */
+            bool isAll;
+
+            /**
+             * The flags of the mask are cleared when the waiting is complete.
+             */
+            bool isClear;
+
+            /**
+             * The flags value which has completed the waiting.
+             */
+            uint32 result;
+
+        };
+
+        /**
+         * Waits for flags of given mask.
+         *
+         * @param mask    the flags to wait for.
+         * @param isAll   true if all flags of the mask are waited.
+         * @param isClear true if the flags of the mask are cleared when the waiting is complete.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return the flags value which has completed the waiting, or zero.
+         */
+        uint32 wait(uint32 mask, bool isAll, bool isClear, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ || mask == 0 ) return 0;
+            bool is = Int::disableAll();
+            uint32 value = flags_;
+            if( isComplete(mask, isAll) )
+            {
+                if(isClear) flags_ &= ~mask;
+                return Int::enableAll(is, value);
+            }
+            if( isTimed && timeout <= 0 ) return Int::enableAll(is, 0);
+            // Only threads might wait for the flags
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return Int::enableAll(is, 0);
+            // The flags value is put to the node by a setting thread before it wakes this one
+            Waiter waiter(*thread, mask, isAll, isClear);
+            fifo_.add(waiter);
+            if( not isTimed )
+            {
+                thread->wait();
+            }
+            else if( not thread->wait(timeout) )
+            {
+                fifo_.remove(waiter);
+                waiter.result = 0;
+            }
+            return Int::enableAll(is, waiter.result);
+        }
+
+        /**
+         * Tests if the flags complete waiting for given mask.
+         *
+         * @param mask  the waited flags.
+         * @param isAll true if all flags of the mask are waited.
+         * @return true if the waiting is complete.
+         */
+        bool isComplete(uint32 mask, bool isAll) const
+        {
+            uint32 flags = flags_ & mask;
+            return isAll ? flags == mask : flags != 0;
+        }
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        EventFlags(const EventFlags& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        EventFlags& operator =(const EventFlags& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The kernel threads scheduler.
+         */
+        ::kernel::Scheduler* scheduler_;
+
+        /**
+         * The flags.
+         */
+        uint32 flags_;
+
+        /**
+         * Queue of waiting threads.
+         */
+        ThreadQueue fifo_;
+
+        /**
+         * Queue of threads which wait for any of several resources.
+         */
+        ThreadQueue observers_;
+
+    };
+}
+#endif // KERNEL_EVENT_FLAGS_HPP_
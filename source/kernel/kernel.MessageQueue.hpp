@@ -0,0 +1,437 @@
+/**
+ * Message queue class.
+ *
+ * The queue is a ring of fixed size messages which memory is allocated once
+ * on creating, and messages are copied by value. A message is copied directly
+ * to a waiting receiver, and a message of a waiting sender is copied directly
+ * to a place which has been released, therefore the messages are never copied twice.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_MESSAGE_QUEUE_HPP_
+#define KERNEL_MESSAGE_QUEUE_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.MessageQueue.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.Allocator.hpp"
+#include "kernel.SchedulerThread.hpp"
+#include "module.Interrupt.hpp"
+#include "library.Memory.hpp"
+
+namespace kernel
+{
+    class MessageQueue : public ::kernel::Object, public ::api::MessageQueue
+    {
+        typedef ::kernel::Object    Parent;
+        typedef ::module::Interrupt Int;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param size     a size of messages in bytes.
+         * @param capacity a number of messages which the queue might contain.
+         */
+        MessageQueue(int32 size, int32 capacity) : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            buffer_        (NULL),
+            size_          (size),
+            capacity_      (capacity),
+            head_          (0),
+            length_        (0),
+            senders_       (),
+            receivers_     (),
+            observers_     (){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~MessageQueue()
+        {
+            ::kernel::Allocator::free(buffer_);
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Sends a message.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool send(const void* message)
+        {
+            return send(message, 0, false);
+        }
+
+        /**
+         * Sends a message within given time.
+         *
+         * @param message a message of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been sent, or false if the time has elapsed.
+         */
+        virtual bool send(const void* message, int64 timeout)
+        {
+            return send(message, timeout, true);
+        }
+
+        /**
+         * Sends a message only if this queue is not full.
+         *
+         * @param message a message of the queue message size.
+         * @return true if the message has been sent.
+         */
+        virtual bool trySend(const void* message)
+        {
+            return send(message, 0, true);
+        }
+
+        /**
+         * Receives a message.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool receive(void* message)
+        {
+            return receive(message, 0, false);
+        }
+
+        /**
+         * Receives a message within given time.
+         *
+         * @param message a buffer of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the message has been received, or false if the time has elapsed.
+         */
+        virtual bool receive(void* message, int64 timeout)
+        {
+            return receive(message, timeout, true);
+        }
+
+        /**
+         * Receives a message only if this queue is not empty.
+         *
+         * @param message a buffer of the queue message size.
+         * @return true if the message has been received.
+         */
+        virtual bool tryReceive(void* message)
+        {
+            return receive(message, 0, true);
+        }
+
+        /**
+         * Returns a size of messages.
+         *
+         * @return the message size in bytes.
+         */
+        virtual int32 getSize() const
+        {
+            return isConstructed_ ? size_ : 0;
+        }
+
+        /**
+         * Returns a number of messages which this queue might contain.
+         *
+         * @return the capacity of the queue.
+         */
+        virtual int32 getCapacity() const
+        {
+            return isConstructed_ ? capacity_ : 0;
+        }
+
+        /**
+         * Returns a number of messages in this queue.
+         *
+         * @return the number of messages.
+         */
+        virtual int32 getLength() const
+        {
+            return isConstructed_ ? length_ : 0;
+        }
+
+        /**
+         * Tests if this resource is blocked.
+         *
+         * @return true if this queue is empty.
+         */
+        virtual bool isBlocked()
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            // A thread which waits for several resources is notified of put messages
+            scheduler_->observe(observers_);
+            bool res = length_ == 0 ? true : false;
+            return Int::enableAll(is, res);
+        }
+
+    private:
+
+        /**
+         * Node of a waiting thread.
+         */
+        class Waiter : public ThreadQueue::Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param thread a waiting thread.
+             * @param idata  a message of the thread.
+             */
+            Waiter(SchedulerThread& thread, void* idata) : ThreadQueue::Node(thread),
+                data (idata){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Waiter(){}
+
+            /**
+             * The message of a sending thread, or the buffer of a receiving thread.
+             */
+            void* data;
+
+        };
+
+        /**
+         * Sends a message.
+         *
+         * @param message a message of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the message has been sent.
+         */
+        bool send(const void* message, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            if( put(message) ) 
+            {
+                // A message handed over to a receiver is not left in this queue
+                bool isPut = length_ != 0 ? true : false;
+                Int::enableAll(is);
+                // The threads which wait for several resources test the messages again
+                if(isPut) scheduler_->notifyObservers(observers_);
+                return true;
+            }
+            if( isTimed && timeout <= 0 ) return Int::enableAll(is, false);
+            // Only threads might wait for a free place
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return Int::enableAll(is, false);
+            // The message is taken by a receiving thread before it wakes this one
+            Waiter waiter(*thread, const_cast<void*>(message));
+            bool res = wait(senders_, waiter, timeout, isTimed);
+            return Int::enableAll(is, res);
+        }
+
+        /**
+         * Receives a message.
+         *
+         * @param message a buffer of the queue message size.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the message has been received.
+         */
+        bool receive(void* message, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            if( get(message) ) return Int::enableAll(is, true);
+            if( isTimed && timeout <= 0 ) return Int::enableAll(is, false);
+            // Only threads might wait for a message
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return Int::enableAll(is, false);
+            // The message is put to the buffer by a sending thread before it wakes this one
+            Waiter waiter(*thread, message);
+            bool res = wait(receivers_, waiter, timeout, isTimed);
+            return Int::enableAll(is, res);
+        }
+
+        /**
+         * Puts a message to this queue, or hands it over to a waiting receiver.
+         *
+         * @param message a message.
+         * @return true if the message has been put.
+         */
+        bool put(const void* message)
+        {
+            // The receivers wait only while this queue is empty
+            while( not receivers_.isEmpty() )
+            {
+                Waiter& waiter = static_cast<Waiter&>(*receivers_.peek());
+                if( scheduler_->wakeThread(waiter) )
+                {
+                    ::library::Memory::memcpy(waiter.data, message, size_);
+                    return true;
+                }
+            }
+            if(length_ == capacity_) return false;
+            ::library::Memory::memcpy(getCell(head_ + length_), message, size_);
+            length_++;
+            return true;
+        }
+
+        /**
+         * Gets the head message of this queue, and takes a message of a waiting sender.
+         *
+         * @param message a buffer.
+         * @return true if the message has been got.
+         */
+        bool get(void* message)
+        {
+            if(length_ == 0) return false;
+            ::library::Memory::memcpy(message, getCell(head_), size_);
+            head_ = head_ + 1 < capacity_ ? head_ + 1 : 0;
+            length_--;
+            // The senders wait only while this queue is full
+            while( not senders_.isEmpty() )
+            {
+                Waiter& waiter = static_cast<Waiter&>(*senders_.peek());
+                if( scheduler_->wakeThread(waiter) )
+                {
+                    ::library::Memory::memcpy(getCell(head_ + length_), waiter.data, size_);
+                    length_++;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Waits for a message to be handed over.
+         *
+         * @param queue   a queue of waiting threads.
+         * @param waiter  a node of current thread.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the message has been handed over.
+         */
+        bool wait(ThreadQueue& queue, Waiter& waiter, int64 timeout, bool isTimed)
+        {
+            SchedulerThread& thread = waiter.getThread();
+            queue.add(waiter);
+            if( not isTimed )
+            {
+                thread.wait();
+                return true;
+            }
+            if( thread.wait(timeout) ) return true;
+            queue.remove(waiter);
+            return false;
+        }
+
+        /**
+         * Returns a place of a message in the ring.
+         *
+         * @param index an index of the message which might exceed the capacity once.
+         * @return the place of the message.
+         */
+        cell* getCell(int32 index) const
+        {
+            if(index >= capacity_) index -= capacity_;
+            return buffer_ + index * size_;
+        }
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            if( size_ <= 0 || capacity_ <= 0 ) return false;
+            buffer_ = reinterpret_cast<cell*>( ::kernel::Allocator::allocate(size_ * capacity_) );
+            if(buffer_ == NULL) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        MessageQueue(const MessageQueue& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        MessageQueue& operator =(const MessageQueue& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The kernel threads scheduler.
+         */
+        ::kernel::Scheduler* scheduler_;
+
+        /**
+         * The ring of messages.
+         */
+        cell* buffer_;
+
+        /**
+         * Size of messages in bytes.
+         */
+        int32 size_;
+
+        /**
+         * Number of messages which the ring might contain.
+         */
+        int32 capacity_;
+
+        /**
+         * Index of the head message.
+         */
+        int32 head_;
+
+        /**
+         * Number of messages in the ring.
+         */
+        int32 length_;
+
+        /**
+         * Queue of threads which wait for a free place.
+         */
+        ThreadQueue senders_;
+
+        /**
+         * Queue of threads which wait for a message.
+         */
+        ThreadQueue receivers_;
+
+        /**
+         * Queue of threads which wait for any of several resources.
+         */
+        ThreadQueue observers_;
+
+    };
+}
+#endif // KERNEL_MESSAGE_QUEUE_HPP_
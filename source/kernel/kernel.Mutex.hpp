@@ -1,5 +1,12 @@
 /**
  * Mutex class.
+ *
+ * The mutex implements the priority inheritance protocol. An owner of the mutex
+ * is executed with the highest priority of threads waiting for it until the owner
+ * unlocks the mutex, and the priority is passed through a chain of owners transitively.
+ *
+ * A priority ceiling mutex raises a locking thread to the ceiling priority immediately,
+ * so threads which priorities do not exceed the ceiling never contend for the mutex.
  * 
  * @author    Sergey Baigudin, sergey@baigudin.software
  * @copyright 2015-2017, Embedded Team, Sergey Baigudin
@@ -12,7 +19,7 @@
 #include "api.Mutex.hpp"
 #include "api.Thread.hpp"
 #include "kernel.Kernel.hpp"
-#include "library.LinkedList.hpp"
+#include "kernel.SchedulerThread.hpp"
 
 namespace kernel
 {  
@@ -28,10 +35,29 @@ namespace kernel
         Mutex() : Parent(),
             isConstructed_ (getConstruct()),
             scheduler_     (NULL),
-            thread_        (NULL),                        
-            id_            (UNLOCKED_ID),
+            owner_         (NULL),
+            next_          (NULL),
+            ceiling_       (-1),
             count_         (1),
-            fifo_          (NULL){    
+            fifo_          (),
+            observers_     (){    
+            setConstruct( construct() );    
+        }
+        
+        /** 
+         * Constructor of priority ceiling mutex.
+         *
+         * @param ceiling the highest priority of threads which lock the mutex.
+         */    
+        Mutex(int32 ceiling) : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            owner_         (NULL),
+            next_          (NULL),
+            ceiling_       (ceiling),
+            count_         (1),
+            fifo_          (),
+            observers_     (){    
             setConstruct( construct() );    
         }
 
@@ -59,32 +85,28 @@ namespace kernel
          */      
         virtual bool lock()
         {
-            if( not isConstructed_ ) return false;
-            bool is = thread_->disable();
-            // The first checking for acquiring available permits of the mutex
-            if( count_ - 1 >= 0 && fifo_.isEmpty() )
-            {
-                // Decrement the number of available permits
-                count_ -= 1;
-                // Go through the mutex to critical section
-                return thread_->enable(is, true);      
-            }
-            ::api::Thread& thread = scheduler_->getCurrentThread();            
-            // Add current thread to the queue tail
-            if( fifo_.add(&thread) == false ) return thread_->enable(is, false);
-            while(true)
-            {
-                // Block current thread on the mutex and switch to another thread
-                thread.block(*this);
-                // Test if head thread is current thread
-                if(fifo_.peek() != &thread) continue;
-                // Test available permits for no breaking the fifo queue by removing
-                if(count_ - 1 < 0) continue;
-                // Decrement the number of available permits
-                count_ -= 1;        
-                // Remove head thread
-                return thread_->enable( is, fifo_.remove() );
-            }    
+            return lock(0, false);
+        }
+        
+        /**
+         * Locks the mutex within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the mutex is locked successfully, or false if the time has elapsed.
+         */      
+        virtual bool lock(int64 timeout)
+        {
+            return lock(timeout, true);
+        }
+        
+        /**
+         * Locks the mutex only if it is not held by another thread.
+         *
+         * @return true if the mutex is locked successfully.
+         */      
+        virtual bool tryLock()
+        {
+            return lock(0, true);
         }
         
         /**
@@ -93,9 +115,30 @@ namespace kernel
         virtual void unlock()
         {
             if( not isConstructed_ ) return;
-            bool is = thread_->disable();
+            scheduler_->lock();
+            // Restore the owner priority only if it has been raised, as the priority
+            // of an owner which runs with its set priority is not lowered by unlocking
+            SchedulerThread* owner = owner_;
+            disown();
+            if( owner != NULL && owner->getPriority() != owner->getBasePriority() ) scheduler_->reorderThread(owner);
+            // Hand the mutex over to the highest priority waiting thread
+            ThreadQueue::Node* node = getHighest();
+            while(node != NULL)
+            {
+                SchedulerThread& thread = node->getThread();
+                if( scheduler_->wakeThread(*node) )
+                {
+                    thread.setMutex(NULL);
+                    own(thread);
+                    if(ceiling_ >= 0) scheduler_->reorderThread(&thread);
+                    scheduler_->unlock();
+                    return;
+                }
+                node = getHighest();
+            }
             count_ += 1;
-            thread_->enable(is);  
+            scheduler_->notifyObservers(observers_);
+            scheduler_->unlock();
         }
         
         /** 
@@ -106,12 +149,158 @@ namespace kernel
         virtual bool isBlocked()
         {
             if( not isConstructed_ ) return false;
-            bool is = thread_->disable();
-            bool res = count_ > 0 ? false : true;
-            return thread_->enable(is, res);  
-        }        
+            // A thread which waits for several resources is notified of unlocking
+            scheduler_->observe(observers_);
+            return count_ > 0 ? false : true;
+        }
+        
+        /**
+         * Returns the thread which holds this mutex.
+         *
+         * @return the owner thread, or NULL if this mutex is unlocked.
+         */
+        SchedulerThread* getOwner() const
+        {
+            return owner_;
+        }
+        
+        /**
+         * Returns next mutex of a list of mutexes which the owner holds.
+         *
+         * @return next mutex, or NULL if this mutex is the last.
+         */
+        Mutex* getNext() const
+        {
+            return next_;
+        }
+        
+        /**
+         * Returns a priority which the owner inherits through this mutex.
+         *
+         * The priority is the highest priority of threads which wait for this mutex,
+         * or the ceiling priority if it is higher.
+         *
+         * @return priority value, or -1 if the owner does not inherit a priority.
+         */
+        int32 getPriority() const
+        {
+            ThreadQueue::Node* node = getHighest();
+            int32 priority = node != NULL ? node->getThread().getPriority() : -1;
+            if(ceiling_ < 0 || owner_ == NULL) return priority;
+            if(priority < 0) return ceiling_;
+            return ReadyQueue::getLevel(priority) > ReadyQueue::getLevel(ceiling_) ? priority : ceiling_;
+        }
   
     private:
+    
+        /**
+         * Locks the mutex.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the mutex is lock successfully.
+         */      
+        bool lock(int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            SchedulerThread* current = scheduler_->getCurrent();
+            if(current == NULL) return false;
+            SchedulerThread& thread = *current;
+            // Mutexes are not changed in interrupts, therefore the scheduler lock is enough
+            scheduler_->lock();
+            // The first checking for acquiring available permits of the mutex
+            if( count_ - 1 >= 0 )
+            {
+                // Decrement the number of available permits
+                count_ -= 1;
+                own(thread);
+                // Raise the owner to the ceiling priority
+                if(ceiling_ >= 0) scheduler_->reorderThread(&thread);
+                // Go through the mutex to critical section
+                scheduler_->unlock();
+                return true;
+            }
+            if( isTimed && timeout <= 0 )
+            {
+                scheduler_->unlock();
+                return false;
+            }
+            // Add current thread to the queue tail, pass its priority to the owner, 
+            // and switch to another thread. The mutex is handed over by an unlocking 
+            // thread before it wakes this one.
+            ThreadQueue::Node node(thread);
+            fifo_.add(node);
+            thread.setMutex(this);
+            scheduler_->reorderThread(owner_);
+            if( not isTimed )
+            {
+                thread.wait();
+                scheduler_->unlock();
+                return true;
+            }
+            bool res = thread.wait(timeout);
+            if( not res )
+            {
+                // Take the priority of the timed out thread back from the owner
+                fifo_.remove(node);
+                thread.setMutex(NULL);
+                scheduler_->reorderThread(owner_);
+            }
+            scheduler_->unlock();
+            return res;
+        }
+        
+        /**
+         * Sets an owner of this mutex.
+         *
+         * @param thread the owner thread.
+         */
+        void own(SchedulerThread& thread)
+        {
+            owner_ = &thread;
+            next_ = thread.getOwned();
+            thread.setOwned(this);
+        }
+        
+        /**
+         * Removes this mutex from the owner list of held mutexes.
+         */
+        void disown()
+        {
+            if(owner_ == NULL) return;
+            Mutex* mutex = owner_->getOwned();
+            if(mutex == this) 
+            {
+                owner_->setOwned(next_);
+            }
+            else
+            {
+                while(mutex != NULL && mutex->next_ != this) mutex = mutex->next_;
+                if(mutex != NULL) mutex->next_ = next_;
+            }
+            owner_ = NULL;
+            next_ = NULL;
+        }
+        
+        /**
+         * Returns the first waiting thread node of the highest priority.
+         *
+         * @return the node, or NULL if no threads wait for the mutex.
+         */
+        ThreadQueue::Node* getHighest() const
+        {
+            ThreadQueue::Node* res = fifo_.peek();
+            if(res == NULL) return NULL;
+            int32 level = ReadyQueue::getLevel( res->getThread().getPriority() );
+            for(ThreadQueue::Node* node = res->getNext(); node != fifo_.peek(); node = node->getNext())
+            {
+                int32 next = ReadyQueue::getLevel( node->getThread().getPriority() );
+                if(next <= level) continue;
+                level = next;
+                res = node;
+            }
+            return res;
+        }
   
         /**
          * Constructor.
@@ -121,9 +310,11 @@ namespace kernel
         bool construct()
         {
             if( not isConstructed_ ) return false;
-            if( not fifo_.isConstructed() ) return false;
-            scheduler_ = &Kernel::call().getScheduler();
-            thread_ = &scheduler_->toggle();
+            if( ceiling_ >= 0 && ceiling_ != ::api::Thread::LOCK_PRIORITY )
+            {
+                if( ceiling_ < ::api::Thread::MIN_PRIORITY || ::api::Thread::MAX_PRIORITY < ceiling_ ) return false;
+            }
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
             return true;
         }        
         
@@ -142,11 +333,6 @@ namespace kernel
          */
         Mutex& operator =(const Mutex& obj);      
         
-        /**
-         * The unlocked id.
-         */
-        static const int64 UNLOCKED_ID = -1;    
-        
         /** 
          * The root object constructed flag.
          */  
@@ -155,17 +341,22 @@ namespace kernel
         /**
          * The kernel threads scheduler.
          */        
-        ::api::Scheduler* scheduler_;
+        ::kernel::Scheduler* scheduler_;
 
         /**
-         * The kernel threads switching toggle.
-         */        
-        ::api::Toggle* thread_;        
-
+         * The thread which holds this mutex.
+         */
+        SchedulerThread* owner_;
+        
         /**
-         * The identifier of locked thread.
+         * Next mutex of mutexes which the owner holds.
          */
-        int64 id_;
+        Mutex* next_;
+        
+        /**
+         * The ceiling priority, or -1 if this mutex inherits priorities of waiting threads.
+         */
+        int32 ceiling_;
         
         /**
          * The mutex counter.
@@ -173,9 +364,14 @@ namespace kernel
         int32 count_;
         
         /** 
-         * Queue of locked threads.
+         * Queue of waiting threads.
          */     
-        ::library::LinkedList< ::api::Thread* > fifo_;
+        ThreadQueue fifo_;
+        
+        /**
+         * Queue of threads which wait for any of several resources.
+         */
+        ThreadQueue observers_;
   
     };
 }
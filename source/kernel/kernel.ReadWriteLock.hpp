@@ -0,0 +1,279 @@
+/**
+ * Reader-writer lock class.
+ *
+ * Writers are preferred to readers, so a reader waits while a writer holds
+ * or waits for the lock, and a released lock is handed over to the first waiting
+ * writer before the waiting readers. The lock is handed over directly by the
+ * releasing thread, and an uncontended reader only changes the counter of readers
+ * while the scheduler is locked.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_READ_WRITE_LOCK_HPP_
+#define KERNEL_READ_WRITE_LOCK_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.ReadWriteLock.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.SchedulerThread.hpp"
+
+namespace kernel
+{
+    class ReadWriteLock : public ::kernel::Object, public ::api::ReadWriteLock
+    {
+        typedef ::kernel::Object Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        ReadWriteLock() : Parent(),
+            isConstructed_ (getConstruct()),
+            scheduler_     (NULL),
+            owner_         (NULL),
+            count_         (0),
+            readers_       (),
+            writers_       (){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~ReadWriteLock()
+        {
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Locks this lock for reading.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool readLock()
+        {
+            return lock(false, 0, false);
+        }
+
+        /**
+         * Locks this lock for reading within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool readLock(int64 timeout)
+        {
+            return lock(false, timeout, true);
+        }
+
+        /**
+         * Locks this lock for reading only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryReadLock()
+        {
+            return lock(false, 0, true);
+        }
+
+        /**
+         * Unlocks this lock held for reading.
+         */
+        virtual void readUnlock()
+        {
+            if( not isConstructed_ ) return;
+            scheduler_->lock();
+            if(count_ > 0) count_--;
+            handOver();
+            scheduler_->unlock();
+        }
+
+        /**
+         * Locks this lock for writing.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool writeLock()
+        {
+            return lock(true, 0, false);
+        }
+
+        /**
+         * Locks this lock for writing within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this lock has been locked, or false if the time has elapsed.
+         */
+        virtual bool writeLock(int64 timeout)
+        {
+            return lock(true, timeout, true);
+        }
+
+        /**
+         * Locks this lock for writing only if it is available.
+         *
+         * @return true if this lock has been locked successfully.
+         */
+        virtual bool tryWriteLock()
+        {
+            return lock(true, 0, true);
+        }
+
+        /**
+         * Unlocks this lock held for writing.
+         */
+        virtual void writeUnlock()
+        {
+            if( not isConstructed_ ) return;
+            scheduler_->lock();
+            if( owner_ == scheduler_->getCurrent() )
+            {
+                owner_ = NULL;
+                handOver();
+            }
+            scheduler_->unlock();
+        }
+
+    private:
+
+        /**
+         * Locks this lock.
+         *
+         * @param isWrite true for writing, or false for reading.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if this lock has been locked successfully.
+         */
+        bool lock(bool isWrite, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return false;
+            scheduler_->lock();
+            if(owner_ == NULL && (isWrite ? count_ == 0 : writers_.isEmpty()))
+            {
+                if(isWrite) owner_ = thread;
+                else count_++;
+                scheduler_->unlock();
+                return true;
+            }
+            if( isTimed && timeout <= 0 )
+            {
+                scheduler_->unlock();
+                return false;
+            }
+            // The lock is taken for the thread by a releasing thread before it wakes this one
+            ThreadQueue& queue = isWrite ? writers_ : readers_;
+            ThreadQueue::Node node(*thread);
+            queue.add(node);
+            bool res = true;
+            if( not isTimed )
+            {
+                thread->wait();
+            }
+            else if( not thread->wait(timeout) )
+            {
+                queue.remove(node);
+                // The readers which have waited behind the timed out writer might be admitted
+                if(isWrite) handOver();
+                res = false;
+            }
+            scheduler_->unlock();
+            return res;
+        }
+
+        /**
+         * Hands this lock over to waiting threads.
+         */
+        void handOver()
+        {
+            if(owner_ != NULL) return;
+            // The threads which have been timed out are skipped
+            while( count_ == 0 && not writers_.isEmpty() )
+            {
+                ThreadQueue::Node& node = *writers_.peek();
+                if( scheduler_->wakeThread(node) )
+                {
+                    owner_ = &node.getThread();
+                    return;
+                }
+            }
+            if( not writers_.isEmpty() ) return;
+            while( not readers_.isEmpty() )
+            {
+                if( scheduler_->wakeThread( *readers_.peek() ) ) count_++;
+            }
+        }
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ReadWriteLock(const ReadWriteLock& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ReadWriteLock& operator =(const ReadWriteLock& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The kernel threads scheduler.
+         */
+        ::kernel::Scheduler* scheduler_;
+
+        /**
+         * Thread which holds this lock for writing.
+         */
+        SchedulerThread* owner_;
+
+        /**
+         * Number of threads which hold this lock for reading.
+         */
+        int32 count_;
+
+        /**
+         * Queue of threads which wait for reading.
+         */
+        ThreadQueue readers_;
+
+        /**
+         * Queue of threads which wait for writing.
+         */
+        ThreadQueue writers_;
+
+    };
+}
+#endif // KERNEL_READ_WRITE_LOCK_HPP_
@@ -0,0 +1,192 @@
+/**
+ * Ready queue of the scheduler.
+ *
+ * The queue contains one FIFO of threads for each priority level and
+ * a bitmap of non-empty levels, so the highest ready thread is selected
+ * by one count leading zeros instruction regardless of threads number.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_READY_QUEUE_HPP_
+#define KERNEL_READY_QUEUE_HPP_
+
+#include "kernel.ThreadQueue.hpp"
+#include "api.Thread.hpp"
+
+namespace kernel
+{
+    class ReadyQueue
+    {
+        typedef ::kernel::ThreadQueue::Node Node;
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        ReadyQueue() :
+            map_ (0){
+        }
+
+        /**
+         * Destructor.
+         */
+       ~ReadyQueue()
+        {
+        }
+
+        /**
+         * Inserts a node to the tail of a priority level FIFO.
+         *
+         * @param node     a unlinked node.
+         * @param priority a priority of the node thread.
+         */
+        void add(Node& node, int32 priority)
+        {
+            int32 level = getLevel(priority);
+            queue_[level].add(node);
+            map_ |= 1 << level;
+        }
+
+        /**
+         * Removes a node from this queue.
+         *
+         * @param node a node of this queue.
+         */
+        void remove(Node& node)
+        {
+            ThreadQueue* queue = node.getQueue();
+            if(queue < &queue_[0] || &queue_[LEVELS - 1] < queue) return;
+            queue->remove(node);
+            if(queue->isEmpty()) map_ &= ~(1 << (queue - &queue_[0]));
+        }
+
+        /**
+         * Moves the head node of a priority level FIFO to its tail.
+         *
+         * @param priority a priority level.
+         */
+        void rotate(int32 priority)
+        {
+            queue_[getLevel(priority)].rotate();
+        }
+
+        /**
+         * Returns the head node of the highest priority level FIFO.
+         *
+         * @return the head node, or NULL if this queue is empty.
+         */
+        Node* peek() const
+        {
+            if(map_ == 0) return NULL;
+            return queue_[31 - countLeadingZeros(map_)].peek();
+        }
+
+        /**
+         * Returns the head node of a priority level FIFO.
+         *
+         * @param priority a priority level.
+         * @return the head node, or NULL if the FIFO is empty.
+         */
+        Node* peek(int32 priority) const
+        {
+            return queue_[getLevel(priority)].peek();
+        }
+
+        /**
+         * Returns a number of nodes of a priority level FIFO.
+         *
+         * @param priority a priority level.
+         * @return number of nodes.
+         */
+        int32 getLength(int32 priority) const
+        {
+            return queue_[getLevel(priority)].getLength();
+        }
+
+        /**
+         * Tests if this queue has no nodes.
+         *
+         * @return true if this queue contains no nodes.
+         */
+        bool isEmpty() const
+        {
+            return map_ == 0 ? true : false;
+        }
+
+        /**
+         * Returns a level of given priority.
+         *
+         * The lock priority is the highest level of the queue.
+         *
+         * @param priority a thread priority.
+         * @return the level index.
+         */
+        static int32 getLevel(int32 priority)
+        {
+            return priority == ::api::Thread::LOCK_PRIORITY ? LEVELS - 1 : priority;
+        }
+
+        /**
+         * Returns a number of leading zero bits of a value.
+         *
+         * @param value a non-zero value.
+         * @return a number of leading zero bits.
+         */
+        static int32 countLeadingZeros(uint32 value)
+        {
+            #if defined(_TMS320C6X)
+            return _lmbd(1, value);
+            #elif defined(__TI_ARM__) || defined(__TMS470__)
+            return _norm(value);
+            #elif defined(__GNUC__)
+            return __builtin_clz(value);
+            #else
+            int32 n = 0;
+            if( (value & 0xffff0000) == 0 ) { n += 16; value <<= 16; }
+            if( (value & 0xff000000) == 0 ) { n +=  8; value <<=  8; }
+            if( (value & 0xf0000000) == 0 ) { n +=  4; value <<=  4; }
+            if( (value & 0xc0000000) == 0 ) { n +=  2; value <<=  2; }
+            if( (value & 0x80000000) == 0 ) { n +=  1; }
+            return n;
+            #endif
+        }
+
+    private:
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ReadyQueue(const ReadyQueue& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ReadyQueue& operator =(const ReadyQueue& obj);
+
+        /**
+         * Number of priority levels which are the levels from MIN_PRIORITY
+         * to MAX_PRIORITY, the level of LOCK_PRIORITY, and the unused zero level.
+         */
+        static const int32 LEVELS = ::api::Thread::MAX_PRIORITY + 2;
+
+        /**
+         * Bitmap of non-empty levels.
+         */
+        uint32 map_;
+
+        /**
+         * FIFOs of priority levels.
+         */
+        ThreadQueue queue_[LEVELS];
+
+    };
+}
+#endif // KERNEL_READY_QUEUE_HPP_
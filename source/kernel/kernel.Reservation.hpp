@@ -0,0 +1,335 @@
+/**
+ * Processor time reservation and period of a thread.
+ *
+ * An earliest deadline first thread is executed for the budget time in each period,
+ * and each job of the thread is scheduled by its absolute deadline which is the period
+ * release time plus the relative deadline. When the budget is exhausted the thread
+ * is throttled until the next period release. A thread without the budget might
+ * only be periodic, then its deadline is the period end.
+ *
+ * The periods are released on absolute boundaries which are multiples of the period
+ * from the first release, and overruns and deadline misses of the jobs are counted.
+ * A late job of a thread without the budget is counted as an overrun only.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_RESERVATION_HPP_
+#define KERNEL_RESERVATION_HPP_
+
+#include "kernel.SleepQueue.hpp"
+
+namespace kernel
+{
+    class Reservation
+    {
+
+    public:
+
+        /**
+         * The utilization value of full processor time.
+         */
+        static const int64 UNIT = 1000000;
+
+        /**
+         * Constructor.
+         *
+         * @param thread a thread of this reservation.
+         */
+        Reservation(SchedulerThread& thread) :
+            period_      (0),
+            budget_      (0),
+            deadline_    (0),
+            utilization_ (0),
+            release_     (0),
+            remaining_   (0),
+            overruns_    (0),
+            misses_      (0),
+            node_        (thread){
+        }
+
+        /**
+         * Destructor.
+         */
+       ~Reservation()
+        {
+        }
+
+        /**
+         * Sets parameters of this reservation.
+         *
+         * The budget must not exceed the relative deadline,
+         * and the relative deadline must not exceed the period.
+         *
+         * @param period   the period in nanoseconds.
+         * @param budget   the execution time in each period in nanoseconds.
+         * @param deadline the relative deadline in nanoseconds.
+         * @return true if the parameters are correct.
+         */
+        bool set(int64 period, int64 budget, int64 deadline)
+        {
+            if(budget <= 0 || deadline < budget || period < deadline) return false;
+            period_ = period;
+            budget_ = budget;
+            deadline_ = deadline;
+            // The first job is released when the thread is started
+            release_ = -1;
+            remaining_ = 0;
+            // Round the utilization up, and scale the values down for avoiding overflow
+            while(budget > MAX_BUDGET)
+            {
+                budget = budget >> 1;
+                deadline = deadline >> 1;
+            }
+            utilization_ = ( budget * UNIT + deadline - 1 ) / deadline;
+            return true;
+        }
+
+        /**
+         * Sets the period of a thread without the budget.
+         *
+         * @param period the period in nanoseconds, or zero to reset periodic mode.
+         * @param time   current time which is the first release time in nanoseconds.
+         * @return true if the period has been set.
+         */
+        bool setPeriod(int64 period, int64 time)
+        {
+            if( isEnabled() || period < 0 ) return false;
+            period_ = period;
+            deadline_ = period;
+            release_ = time;
+            return true;
+        }
+
+        /**
+         * Resets this reservation.
+         */
+        void reset()
+        {
+            period_ = 0;
+            budget_ = 0;
+            deadline_ = 0;
+            utilization_ = 0;
+        }
+
+        /**
+         * Tests if this reservation is set.
+         *
+         * @return true if the thread is scheduled by its deadline.
+         */
+        bool isEnabled() const
+        {
+            return budget_ > 0 ? true : false;
+        }
+
+        /**
+         * Tests if the thread is periodic.
+         *
+         * @return true if the period is set.
+         */
+        bool isPeriodic() const
+        {
+            return period_ > 0 ? true : false;
+        }
+
+        /**
+         * Releases a new job if the next period has come.
+         *
+         * @param time current time in nanoseconds.
+         */
+        void replenish(int64 time)
+        {
+            if(release_ < 0)
+            {
+                release_ = time;
+            }
+            else
+            {
+                if(time < release_ + period_) return;
+                // Release the job on the last period boundary 
+                release_ += (time - release_) / period_ * period_;
+            }
+            remaining_ = budget_;
+        }
+
+        /**
+         * Completes the current job.
+         *
+         * @param time current time in nanoseconds.
+         * @return release time of the next job in nanoseconds.
+         */
+        int64 complete(int64 time)
+        {
+            // A late thread without the budget overruns its period only
+            if( isEnabled() && time > getDeadline() ) misses_++;
+            int64 next = release_ + period_;
+            // The next job has already been released
+            if(time >= next)
+            {
+                if( not isEnabled() ) overruns_++;
+                next += (time - next) / period_ * period_;
+            }
+            // The budget threads are released by replenishing on wake up 
+            if( not isEnabled() ) release_ = next;
+            return next;
+        }
+
+        /**
+         * Counts the budget overrun of the current job.
+         */
+        void overrun()
+        {
+            overruns_++;
+        }
+
+        /**
+         * Charges the current job for executed time.
+         *
+         * @param time the executed time in nanoseconds.
+         */
+        void charge(int64 time)
+        {
+            remaining_ -= time;
+        }
+
+        /**
+         * Returns the utilization of this reservation.
+         *
+         * @return the utilization rounded up in parts of UNIT.
+         */
+        int64 getUtilization() const
+        {
+            return utilization_;
+        }
+
+        /**
+         * Returns the absolute deadline of the current job.
+         *
+         * @return time in nanoseconds.
+         */
+        int64 getDeadline() const
+        {
+            return release_ + deadline_;
+        }
+
+        /**
+         * Returns release time of the next job.
+         *
+         * @return time in nanoseconds.
+         */
+        int64 getRelease() const
+        {
+            return release_ + period_;
+        }
+
+        /**
+         * Returns the remaining budget of the current job.
+         *
+         * @return time in nanoseconds.
+         */
+        int64 getRemaining() const
+        {
+            return remaining_;
+        }
+
+        /**
+         * Returns a number of overrun jobs.
+         *
+         * @return number of overruns.
+         */
+        int32 getOverrunCount() const
+        {
+            return overruns_;
+        }
+
+        /**
+         * Returns a number of jobs which have missed their deadlines.
+         *
+         * @return number of deadline misses.
+         */
+        int32 getMissCount() const
+        {
+            return misses_;
+        }
+
+        /**
+         * Returns the node of the scheduler deadline queue.
+         *
+         * @return the node.
+         */
+        SleepQueue::Node& getNode()
+        {
+            return node_;
+        }
+
+    private:
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        Reservation(const Reservation& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        Reservation& operator =(const Reservation& obj);
+
+        /**
+         * The maximum budget which is multiplied by the unit without overflow.
+         */
+        static const int64 MAX_BUDGET = 0x7fffffff / UNIT * 0x100000000;
+
+        /**
+         * The period in nanoseconds.
+         */
+        int64 period_;
+
+        /**
+         * The execution time in each period in nanoseconds.
+         */
+        int64 budget_;
+
+        /**
+         * The relative deadline in nanoseconds.
+         */
+        int64 deadline_;
+
+        /**
+         * The utilization in parts of UNIT.
+         */
+        int64 utilization_;
+
+        /**
+         * Release time of the current job in nanoseconds, or -1 if no job has been released.
+         */
+        int64 release_;
+
+        /**
+         * The remaining budget of the current job in nanoseconds.
+         */
+        int64 remaining_;
+
+        /**
+         * Number of overrun jobs.
+         */
+        int32 overruns_;
+
+        /**
+         * Number of jobs which have missed their deadlines.
+         */
+        int32 misses_;
+
+        /**
+         * Node of the scheduler deadline queue which keeps the absolute deadline.
+         */
+        SleepQueue::Node node_;
+
+    };
+}
+#endif // KERNEL_RESERVATION_HPP_
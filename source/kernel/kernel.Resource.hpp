@@ -14,7 +14,14 @@
 #include "kernel.Time.hpp"
 #include "kernel.Mutex.hpp"
 #include "kernel.Semaphore.hpp"
+#include "kernel.ConditionVariable.hpp"
+#include "kernel.ReadWriteLock.hpp"
+#include "kernel.Barrier.hpp"
+#include "kernel.EventFlags.hpp"
+#include "kernel.MessageQueue.hpp"
 #include "kernel.Interrupt.hpp"
+#include "kernel.SoftwareInterrupt.hpp"
+#include "kernel.SoftwareTimer.hpp"
 #include "kernel.Scheduler.hpp"
 #include "kernel.GlobalInterrupt.hpp"
 #include "Configuration.hpp"
@@ -36,6 +43,8 @@ namespace kernel
             isConstructed_ (getConstruct()),        
             config_        (config),            
             scheduler_     (),
+            swi_           (config.swiSource, scheduler_.toggle()),
+            timers_        (),
             time_          (),
             global_        (),
             runtime_       (){    
@@ -123,6 +132,21 @@ namespace kernel
             return NULL;   
         }
         
+        /** 
+         * Creates new priority ceiling mutex resource.
+         *
+         * @param ceiling the highest priority of threads which lock the mutex.
+         * @return new mutex resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::Mutex* createMutex(int32 ceiling)
+        {
+            ::api::Mutex* res = new Mutex(ceiling);
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL;   
+        }
+        
         /** 
          * Creates new semaphore resource.
          *
@@ -154,6 +178,79 @@ namespace kernel
             return NULL; 
         }        
         
+        /** 
+         * Creates new condition variable resource.
+         *
+         * @return new condition variable resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::ConditionVariable* createConditionVariable()
+        {
+            ::api::ConditionVariable* res = new ConditionVariable();
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL; 
+        }        
+        
+        /** 
+         * Creates new reader-writer lock resource.
+         *
+         * @return new reader-writer lock resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::ReadWriteLock* createReadWriteLock()
+        {
+            ::api::ReadWriteLock* res = new ReadWriteLock();
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL; 
+        }        
+        
+        /** 
+         * Creates new cyclic barrier resource.
+         *
+         * @param parties a number of threads which have to arrive to trip the barrier.
+         * @return new barrier resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::Barrier* createBarrier(int32 parties)
+        {
+            ::api::Barrier* res = new Barrier(parties);
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL; 
+        }        
+        
+        /** 
+         * Creates new event flags resource.
+         *
+         * @return new event flags resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::EventFlags* createEventFlags()
+        {
+            ::api::EventFlags* res = new EventFlags();
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL; 
+        }        
+        
+        /** 
+         * Creates new message queue resource.
+         *
+         * @param size     a size of messages in bytes.
+         * @param capacity a number of messages which the queue might contain.
+         * @return new message queue resource, or NULL if error has been occurred.
+         */      
+        virtual ::api::MessageQueue* createMessageQueue(int32 size, int32 capacity)
+        {
+            ::api::MessageQueue* res = new MessageQueue(size, capacity);
+            if(res == NULL) return NULL; 
+            if(res->isConstructed()) return res;       
+            delete res;
+            return NULL; 
+        }        
+        
         /**
          * Creates new interrupt resource.
          *
@@ -169,6 +266,37 @@ namespace kernel
             delete res;
             return NULL;       
         }
+
+        /**
+         * Creates new software interrupt resource.
+         *
+         * @param handler  user class which implements an interrupt handler interface.
+         * @param priority a priority of the interrupt in range [0, 31] where 31 is the highest.
+         * @return new software interrupt resource, or NULL if error has been occurred.
+         */
+        virtual ::api::Interrupt* createSoftwareInterrupt(::api::Task& handler, int32 priority)
+        {
+            ::api::Interrupt* res = new SoftwareInterrupt(swi_, handler, priority);
+            if(res == NULL) return NULL;
+            if(res->isConstructed()) return res;
+            delete res;
+            return NULL;
+        }
+
+        /**
+         * Creates new software timer resource.
+         *
+         * @param handler user class which implements a timer handler interface.
+         * @return new software timer resource, or NULL if error has been occurred.
+         */
+        virtual ::api::SoftwareTimer* createSoftwareTimer(::api::Task& handler)
+        {
+            ::api::SoftwareTimer* res = new SoftwareTimer(timers_, handler);
+            if(res == NULL) return NULL;
+            if(res->isConstructed()) return res;
+            delete res;
+            return NULL;
+        }
         
     private:
     
@@ -181,6 +309,7 @@ namespace kernel
         {
             if( not isConstructed_ ) return false;
             if( not scheduler_.isConstructed() ) return false;
+            if( config_.swiSource >= 0 && not swi_.isConstructed() ) return false;
             if( not time_.isConstructed() ) return false;
             if( not global_.isConstructed() ) return false;            
             if( not runtime_.isConstructed() ) return false;            
@@ -217,6 +346,16 @@ namespace kernel
          */
         Scheduler scheduler_;
 
+        /**
+         * Software interrupts dispatcher.
+         */
+        SoftwareInterruptDispatcher swi_;
+
+        /**
+         * Software timers service.
+         */
+        TimerService timers_;
+
         /**
          * Kernel time.
          */        
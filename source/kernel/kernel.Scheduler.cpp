@@ -7,6 +7,7 @@
  */
 #include "kernel.Scheduler.hpp" 
 #include "kernel.SchedulerThread.hpp" 
+#include "kernel.Mutex.hpp"
 #include "kernel.Kernel.hpp"
 #include "module.Interrupt.hpp"
 #include "module.Timer.hpp"
@@ -18,7 +19,21 @@ namespace kernel
      */
     Scheduler::Scheduler() : Parent(),
         isConstructed_ (getConstruct()),      
-        list_          (NULL),
+        ready_         (),
+        wait_          (),
+        observer_      (NULL),
+        sleep_         (),
+        edf_           (),
+        current_       (NULL),
+        dispatched_    (0),
+        isYielded_     (false),
+        lock_          (0),
+        isPending_     (false),
+        toggle_        (*this),
+        utilization_   (0),
+        idleTask_      (),
+        idle_          (NULL),
+        count_         (0),
         idCount_       (0){
         setConstruct( construct() );
     }
@@ -28,6 +43,8 @@ namespace kernel
      */
     Scheduler::~Scheduler()
     {
+        delete idle_;
+        idle_ = NULL;
     }
     
     /**
@@ -45,66 +62,110 @@ namespace kernel
      */      
     void Scheduler::main()
     {
-        SchedulerThread* thread;
         // Test for completing execution
-        if( list_.isEmpty() )
+        if( count_ == 0 )
         {
+            current_ = NULL;
             restoreContext();
             stop();        
             setCount(0);
             setPeriod();
             return;
         }
-        // Select next thread for executing
-        while(true)
+        // Defer switching while the executing thread has locked the scheduler
+        if( lock_ != 0 && not isYielded_ )
         {
-            thread = list_.peek();
-            switch( thread->getStatus() )
+            isPending_ = true;
+            return;
+        }
+        isPending_ = false;
+        // Charge the executing thread for its execution time
+        int64 time = Kernel::call().getExecutionTime().getValue();
+        SchedulerThread* previous = current_;
+        bool isVoluntary = isYielded_;
+        isYielded_ = false;
+        if( previous != NULL )
+        {
+            if( previous->getStatus() != ::api::Thread::RUNNING ) isVoluntary = true;
+            previous->charge(time - dispatched_);
+            if( previous->getReservation().isEnabled() )
             {
-                case ::api::Thread::BLOCKED: 
-                    if( not thread->getBlock()->isBlocked() )
-                    {
-                        thread->setStatus( ::api::Thread::RUNNABLE );
-                    }
-                    break;
-                    
-                case ::api::Thread::SLEEPING: 
-                    if( Kernel::call().getExecutionTime().getValue() >= thread->getSleep() )
-                    {
-                        thread->setSleep(0);
-                        thread->setStatus( ::api::Thread::RUNNABLE );
-                    }
-                    break;             
-                    
-                case ::api::Thread::RUNNING: 
-                    thread->setStatus( ::api::Thread::RUNNABLE );
-                    break;
-                    
-                case ::api::Thread::RUNNABLE:
+                previous->getReservation().charge(time - dispatched_);
+            }
+        }
+        // Resume sleeping threads which wake up time has come
+        if( not sleep_.isEmpty() )
+        {
+            SleepQueue::Node* sleeping = sleep_.peek();
+            while( sleeping != NULL && sleeping->getTime() <= time )
+            {
+                // The thread which waits for a resource has not been woken up by the resource in time
+                SchedulerThread& thread = sleeping->getThread();
+                if( thread.getStatus() == ::api::Thread::WAITING ) thread.timeOut();
+                resumeThread(&thread);
+                sleeping = sleep_.peek();
+            }
+        }
+        // Resume blocked threads which resources have been released
+        bool poll = false;
+        ThreadQueue::Node* node = wait_.peek();
+        for(int32 i = wait_.getLength(); i > 0; i--)
+        {
+            SchedulerThread& thread = node->getThread();
+            node = node->getNext();
+            if( thread.getBlock()->isBlocked() )
+            {
+                poll = true;
+            }
+            else
+            {
+                resumeThread(&thread);
+            }
+        }
+        // Move the executing thread to the tail of its priority level
+        if( current_ != NULL && current_->getStatus() == ::api::Thread::RUNNING )
+        {
+            current_->setStatus( ::api::Thread::RUNNABLE );
+            if( current_->getReservation().isEnabled() )
+            {
+                // Throttle the deadline thread which budget is exhausted
+                if( current_->getReservation().getRemaining() <= 0 )
                 {
-                    thread->setStatus( ::api::Thread::RUNNING );
-                    // Switch to the task
-                    int32 priority = thread->getPriority();
-                    setContext( *thread->getRegister() );                    
-                    if(priority == ::api::Thread::LOCK_PRIORITY)
-                    {
-                        stop();        
-                    }
-                    else
-                    {
-                        start();
-                    }
-                    setCount(0);
-                    setPeriod(priority * QUANT);
-                    return;
+                    current_->getReservation().overrun();
+                    removeReady(current_);
+                    addReady(current_);
                 }
-                
-                default:
-                    break;
             }
-            list_.remove();
-            list_.add(thread);
-        }    
+            else if( ready_.peek() == &current_->getNode() )
+            {
+                ready_.rotate( current_->getPriority() );
+            }
+        }
+        // Select the earliest deadline thread, or the head thread of the highest priority level,
+        // and the lock priority threads are executed before the deadline threads
+        node = ready_.peek();
+        SchedulerThread* thread = node != NULL ? &node->getThread() : NULL;
+        if( not edf_.isEmpty() && (thread == NULL || thread->getPriority() != ::api::Thread::LOCK_PRIORITY) )
+        {
+            thread = &edf_.peek()->getThread();
+        }
+        if(thread == NULL) thread = idle_;
+        thread->setStatus( ::api::Thread::RUNNING );
+        if( thread != previous )
+        {
+            if( previous != NULL ) 
+            {
+                previous->countSwitch(isVoluntary);
+                previous->setLock(lock_);
+            }
+            thread->dispatch(time);
+            lock_ = thread->getLock();
+        }
+        current_ = thread;
+        dispatched_ = time;
+        // Switch to the thread
+        setContext( *thread->getRegister() );                    
+        setTimer(time, poll);
     }
     
     /**
@@ -133,6 +194,47 @@ namespace kernel
         return NULL;
     }
     
+    /**
+     * Creates a new earliest deadline first thread.
+     *
+     * @param task     an user task which main method will be invoked when created thread is started.
+     * @param period   the thread period in nanoseconds.
+     * @param budget   the thread execution time in each period in nanoseconds.
+     * @param deadline the relative deadline of each period in nanoseconds.
+     * @return a new thread, or NULL if the thread is not admitted.
+     */
+    ::api::Thread* Scheduler::createThread(::api::Task& task, int64 period, int64 budget, int64 deadline)
+    {
+        if( not isConstructed_ ) return NULL;
+        SchedulerThread* thread = new SchedulerThread(task, ++idCount_, &mainThread, this);
+        if(thread == NULL) return NULL; 
+        if(thread->isConstructed())
+        {
+            Reservation& reservation = thread->getReservation();
+            bool is = Int::disableAll();
+            // Admit the thread if the utilization of all deadline threads does not exceed one
+            bool res = reservation.set(period, budget, deadline);
+            if(res && utilization_ + reservation.getUtilization() <= Reservation::UNIT)
+            {
+                utilization_ += reservation.getUtilization();
+            }
+            else
+            {
+                reservation.reset();
+                res = false;
+            }
+            Int::enableAll(is);
+            // Mutex owners inherit the highest priority from the deadline thread
+            if(res) 
+            {
+                thread->setPriority( ::api::Thread::MAX_PRIORITY );
+                return thread;  
+            }
+        }
+        delete thread;
+        return NULL;
+    }
+    
     /**
      * Returns currently executing thread.
      *
@@ -140,12 +242,9 @@ namespace kernel
      */
     ::api::Thread& Scheduler::getCurrentThread()
     {
-        ::api::Runtime& runtime = Kernel::call().getRuntime();
-        if( not isConstructed_ ) runtime.terminate(-1);
-        bool is = Int::disableAll();
-        ::api::Thread* thread = list_.peek();
-        Int::enableAll(is);
-        if(thread == NULL) runtime.terminate(-1);
+        // The pointer is changed only while the thread is not executed, so it is read without masking
+        ::api::Thread* thread = current_;
+        if(thread == NULL) Kernel::call().getRuntime().terminate(-1);
         return *thread;
     }
     
@@ -155,7 +254,10 @@ namespace kernel
     void Scheduler::yield()
     {
         if( not isConstructed_ ) return;
+        bool is = Int::disableAll();
+        isYielded_ = true;
         jump();    
+        Int::enableAll(is);
     }
     
     /** 
@@ -165,9 +267,9 @@ namespace kernel
      */ 
     ::api::Toggle& Scheduler::toggle()
     {
-        return *this;
+        return toggle_;
     }    
-
+    
     /** 
      * Constructor.
      *
@@ -180,7 +282,9 @@ namespace kernel
     bool Scheduler::construct()
     {
         if( not isConstructed() ) return false;
-        if( not list_.isConstructed() ) return false;
+        idle_ = new SchedulerThread(idleTask_, 0, &mainThread, this);
+        if(idle_ == NULL || not idle_->isConstructed()) return false;
+        idle_->setPriority( ::api::Thread::MIN_PRIORITY );
         int32 source = getInterrupSource();
         if( not setHandler(*this, source) ) return false;
         setCount(0);
@@ -198,10 +302,15 @@ namespace kernel
     bool Scheduler::addThread(SchedulerThread* thread)
     {
         if( not isConstructed_ ) return false;
+        // Reserve the sleep and the deadline queues for all started threads
+        if( not sleep_.reserve(count_ + 1) ) return false;
+        if( not edf_.reserve(count_ + 1) ) return false;
         bool is = Int::disableAll();
-        bool res = list_.add(thread);
+        addReady(thread);
+        count_++;
+        preempt(thread);
         Int::enableAll(is);    
-        return res;
+        return true;
     }    
     
     /**
@@ -210,25 +319,342 @@ namespace kernel
      * @param thread removing thread.
      */
     void Scheduler::removeThread(SchedulerThread* thread)
+    {
+        if( not isConstructed_ ) return;
+        if( thread == idle_ ) return;
+        bool is = Int::disableAll();
+        // Release the utilization of the deadline thread
+        Reservation& reservation = thread->getReservation();
+        if( reservation.isEnabled() )
+        {
+            utilization_ -= reservation.getUtilization();
+            reservation.reset();
+            edf_.remove( reservation.getNode() );
+        }
+        switch( thread->getStatus() )
+        {
+            case ::api::Thread::RUNNABLE: 
+            case ::api::Thread::RUNNING: 
+                ready_.remove(thread->getNode());
+                count_--;
+                break;
+                
+            case ::api::Thread::BLOCKED: 
+                wait_.remove(thread->getNode());
+                count_--;
+                break;
+                
+            case ::api::Thread::WAITING: 
+                sleep_.remove(thread->getSleepNode());
+                count_--;
+                break;
+                
+            case ::api::Thread::SLEEPING: 
+                sleep_.remove(thread->getSleepNode());
+                count_--;
+                break;
+                
+            default:
+                break;
+        }
+        Int::enableAll(is);
+    }
+    
+    /**
+     * Removes a thread from the ready queue.
+     *
+     * The thread status must be set to blocked or waiting before calling.
+     * A blocked thread is added to the waiting list which resources are polled.
+     *
+     * @param thread suspending thread.
+     */
+    void Scheduler::suspendThread(SchedulerThread* thread)
+    {
+        if( not isConstructed_ ) return;
+        bool is = Int::disableAll();
+        removeReady(thread);
+        if( thread->getStatus() == ::api::Thread::BLOCKED )
+        {
+            wait_.add(thread->getNode());
+        }
+        Int::enableAll(is);
+    }
+    
+    /**
+     * Moves a thread from the ready queue to the sleep queue.
+     *
+     * The thread status must be set to sleeping before calling,
+     * or to waiting if the thread waits for a resource with a timeout.
+     *
+     * @param thread sleeping thread.
+     * @param time   wake up time in nanoseconds.
+     */
+    void Scheduler::sleepThread(SchedulerThread* thread, int64 time)
+    {
+        if( not isConstructed_ ) return;
+        bool is = Int::disableAll();
+        removeReady(thread);
+        sleep_.add(thread->getSleepNode(), time);
+        Int::enableAll(is);
+    }
+    
+    /**
+     * Moves a thread from the waiting list or the sleep queue to the ready queue.
+     *
+     * @param thread resuming thread.
+     */
+    void Scheduler::resumeThread(SchedulerThread* thread)
     {
         if( not isConstructed_ ) return;
         bool is = Int::disableAll();
-        list_.removeElement(thread);
+        wait_.remove(thread->getNode());
+        sleep_.remove(thread->getSleepNode());
+        thread->setStatus( ::api::Thread::RUNNABLE );
+        addReady(thread);
         Int::enableAll(is);
     }
     
+    /**
+     * Removes a node from its wait queue and resumes the node thread.
+     *
+     * @param node a node of a kernel resource wait queue.
+     * @return true if the node thread was waiting and has been resumed.
+     */
+    bool Scheduler::wakeThread(ThreadQueue::Node& node)
+    {
+        if( not isConstructed_ ) return false;
+        bool is = Int::disableAll();
+        ThreadQueue* queue = node.getQueue();
+        if(queue != NULL) queue->remove(node);
+        SchedulerThread* thread = &node.getThread();
+        bool res = thread->getStatus() == ::api::Thread::WAITING ? true : false;
+        if(res)
+        {
+            resumeThread(thread);
+            preempt(thread);
+        }
+        return Int::enableAll(is, res);
+    }
+    
+    /**
+     * Sets the effective priority of a thread and moves it to the tail of its priority level.
+     *
+     * The method is called when a thread priority or waiters of mutexes it holds have been changed.
+     * The priority is inherited by owners of mutexes which the thread waits for transitively.
+     *
+     * @param thread reordering thread.
+     */
+    void Scheduler::reorderThread(SchedulerThread* thread)
+    {
+        if( not isConstructed_ ) return;
+        // Mutexes are not changed in interrupts, therefore the scheduler lock is enough for the chain
+        lock();
+        // Go through the chain of mutex owners which the thread waits for
+        while(thread != NULL)
+        {
+            // Inherit the highest priority of threads which wait for mutexes held by the thread
+            int32 priority = thread->getBasePriority();
+            for(Mutex* mutex = thread->getOwned(); mutex != NULL; mutex = mutex->getNext())
+            {
+                int32 inherited = mutex->getPriority();
+                if(inherited < 0) continue;
+                if( ReadyQueue::getLevel(inherited) > ReadyQueue::getLevel(priority) ) priority = inherited;
+            }
+            if(priority == thread->getPriority()) break;
+            bool is = Int::disableAll();
+            switch( thread->getStatus() )
+            {
+                case ::api::Thread::RUNNABLE: 
+                case ::api::Thread::RUNNING: 
+                    if(thread == idle_ || thread->getReservation().isEnabled()) break;
+                    ready_.remove(thread->getNode());
+                    ready_.add(thread->getNode(), priority);
+                    break;
+                    
+                default:
+                    break;
+            }
+            thread->setEffectivePriority(priority);
+            Int::enableAll(is);
+            Mutex* mutex = thread->getMutex();
+            thread = mutex != NULL ? mutex->getOwner() : NULL;
+        }
+        // The executing thread might have been lowered
+        bool is = Int::disableAll();
+        ThreadQueue::Node* node = ready_.peek();
+        if(node != NULL) preempt( &node->getThread() );
+        Int::enableAll(is);
+        unlock();
+    }
+    
+    /**
+     * Requests switching to a thread which has been made ready if it must be executed before the executing thread.
+     *
+     * The scheduler interrupt is set pending instead of jumping to it, 
+     * so the method might be called in an interrupt context too.
+     *
+     * @param thread a ready thread.
+     */  
+    void Scheduler::preempt(SchedulerThread* thread)
+    {
+        if( current_ == NULL ) return;
+        if( thread->getStatus() != ::api::Thread::RUNNABLE ) return;
+        if( current_ != idle_ )
+        {
+            bool isEdf = thread->getReservation().isEnabled();
+            bool isCurrentEdf = current_->getReservation().isEnabled();
+            // The deadline threads are executed before others except the lock priority threads
+            if( isEdf && isCurrentEdf )
+            {
+                if( thread->getReservation().getDeadline() >= current_->getReservation().getDeadline() ) return;
+            }
+            else if( isEdf )
+            {
+                if( current_->getPriority() == ::api::Thread::LOCK_PRIORITY ) return;
+            }
+            else if( isCurrentEdf )
+            {
+                if( thread->getPriority() != ::api::Thread::LOCK_PRIORITY ) return;
+            }
+            else
+            {
+                int32 level = ReadyQueue::getLevel( thread->getPriority() );
+                int32 currentLevel = ReadyQueue::getLevel( current_->getPriority() );
+                if( level < currentLevel ) return;
+                #ifndef EOOS_TICKLESS
+                if( level == currentLevel ) return;
+                #endif
+            }
+        }
+        set();
+    }
+    
+    /**
+     * Adds a thread to the ready queue or to the deadline queue.
+     *
+     * @param thread a runnable thread.
+     */  
+    void Scheduler::addReady(SchedulerThread* thread)
+    {
+        Reservation& reservation = thread->getReservation();
+        if( not reservation.isEnabled() )
+        {
+            ready_.add(thread->getNode(), thread->getPriority());
+            return;
+        }
+        int64 time = Kernel::call().getExecutionTime().getValue();
+        reservation.replenish(time);
+        if( reservation.getRemaining() > 0 )
+        {
+            edf_.add(reservation.getNode(), reservation.getDeadline());
+            return;
+        }
+        // Throttle the thread till its next period
+        thread->setStatus( ::api::Thread::SLEEPING );
+        sleep_.add(thread->getSleepNode(), reservation.getRelease());
+    }
+    
+    /**
+     * Removes a thread from the ready queue or from the deadline queue.
+     *
+     * @param thread a ready thread.
+     */  
+    void Scheduler::removeReady(SchedulerThread* thread)
+    {
+        Reservation& reservation = thread->getReservation();
+        if( reservation.isEnabled() )
+        {
+            edf_.remove( reservation.getNode() );
+        }
+        else
+        {
+            ready_.remove( thread->getNode() );
+        }
+    }
+    
+    /**
+     * Programs the scheduler timer for the executing thread.
+     *
+     * @param time current time in nanoseconds if the sleep queue is not empty.
+     * @param poll true if a blocked thread exists which resource has to be polled.
+     */  
+    void Scheduler::setTimer(int64 time, bool poll)
+    {
+        int32 priority = current_->getPriority();
+        stop();
+        setCount(0);
+        // The locked thread is never switched by the timer
+        if(priority == ::api::Thread::LOCK_PRIORITY) 
+        {
+            setPeriod();
+            return;
+        }
+        // The deadline thread is switched when its budget is exhausted
+        int64 budget = 0;
+        if( current_->getReservation().isEnabled() )
+        {
+            budget = ( current_->getReservation().getRemaining() + 999 ) / 1000;
+            if(budget < 1) budget = 1;
+        }
+        #ifdef EOOS_TICKLESS
+        int64 period = budget;
+        // The time slice is needed for switching threads of one priority
+        if( budget == 0 && current_ != idle_ && ready_.getLength(priority) > 1 )
+        {
+            period = priority * QUANT;
+        }
+        // The resources of blocked threads are polled every quant
+        if( poll && (period == 0 || period > QUANT) )
+        {
+            period = QUANT;
+        }
+        // The earliest sleeping thread has to be woken up in time
+        if( not sleep_.isEmpty() )
+        {
+            int64 delay = ( sleep_.peek()->getTime() - time + 999 ) / 1000;
+            if(delay < 1) delay = 1;
+            if(period == 0 || period > delay) period = delay;
+        }
+        // Nobody is waiting for the timer 
+        if(period == 0) 
+        {
+            setPeriod();
+            return;
+        }
+        // Limit the period by the timer counter capacity
+        int32 digit = getDigit();
+        int64 clock = getInternalClock();
+        if(digit < 63 && clock != 0)
+        {
+            int64 max = ( static_cast<int64>(1) << digit ) / clock * 1000000;
+            if(max > 0 && period > max) period = max;
+        }
+        #else
+        // The fixed period does not depend on the time and the polled resources
+        static_cast<void>(time);
+        static_cast<void>(poll);
+        int64 period = priority * QUANT;
+        if(budget != 0 && period > budget) period = budget;
+        #endif
+        setPeriod(period);
+        start();
+    }
+    
     /**
      * Runs a method of Runnable interface start vector.
      */  
     void Scheduler::run()
     {
-        SchedulerThread* current = list_.peek();
+        SchedulerThread* current = current_;
         // Start main method of user thread task
         current->getTask()->main();
         Int::disableAll();
-        current->setStatus( ::api::Thread::DEAD );
         // Remove this executed task
-        list_.remove();
+        removeThread(current);
+        current->setStatus( ::api::Thread::DEAD );
+        // Wake the threads which wait for this thread to die
+        ThreadQueue& queue = current->getJoinQueue();
+        while( not queue.isEmpty() ) wakeThread( *queue.peek() );
         yield();
     }        
     
@@ -11,7 +11,8 @@
 #include "kernel.TimerInterrupt.hpp"
 #include "api.Scheduler.hpp"
 #include "api.Task.hpp"
-#include "library.LinkedList.hpp"
+#include "kernel.ReadyQueue.hpp"
+#include "kernel.SleepQueue.hpp"
 
 namespace kernel
 {
@@ -61,6 +62,17 @@ namespace kernel
          */
         virtual ::api::Thread* createThread(::api::Task& task);
         
+        /**
+         * Creates a new earliest deadline first thread.
+         *
+         * @param task     an user task which main method will be invoked when created thread is started.
+         * @param period   the thread period in nanoseconds.
+         * @param budget   the thread execution time in each period in nanoseconds.
+         * @param deadline the relative deadline of each period in nanoseconds.
+         * @return a new thread, or NULL if the thread is not admitted.
+         */
+        virtual ::api::Thread* createThread(::api::Task& task, int64 period, int64 budget, int64 deadline);
+        
         /**
          * Returns currently executing thread.
          *
@@ -80,6 +92,119 @@ namespace kernel
          */ 
         virtual ::api::Toggle& toggle();
         
+        /**
+         * Returns currently executing thread.
+         *
+         * The pointer is updated by the scheduler on each switch.
+         *
+         * @return executing thread, or NULL if no thread is executed.
+         */
+        SchedulerThread* getCurrent() const
+        {
+            return current_;
+        }
+        
+        /**
+         * Sets a node of the executing thread which waits for any of several resources.
+         *
+         * The node is set while the thread tests one of the resources,
+         * and a kernel resource links it to the observers of the resource.
+         *
+         * @param node a unlinked node of the executing thread, or NULL.
+         */
+        void setObserver(ThreadQueue::Node* node)
+        {
+            observer_ = node;
+        }
+        
+        /**
+         * Returns the set node which has not been linked by a tested resource.
+         *
+         * @return the node, or NULL if the node has been linked or has not been set.
+         */
+        ThreadQueue::Node* getObserver() const
+        {
+            return observer_;
+        }
+        
+        /**
+         * Links the set node of the executing thread to observers of a kernel resource.
+         *
+         * The method is called by a kernel resource which is being tested, and 
+         * which notifies the observers when it might have become not blocked.
+         *
+         * @param observers the observers queue of the resource.
+         */
+        void observe(ThreadQueue& observers)
+        {
+            if(observer_ == NULL) return;
+            bool is = Int::disableAll();
+            observers.add(*observer_);
+            observer_ = NULL;
+            Int::enableAll(is);
+        }
+        
+        /**
+         * Unlinks a node of a thread which has waited for any of several resources.
+         *
+         * @param node a node of the thread.
+         */
+        void unobserve(ThreadQueue::Node& node)
+        {
+            bool is = Int::disableAll();
+            ThreadQueue* queue = node.getQueue();
+            if(queue != NULL) queue->remove(node);
+            Int::enableAll(is);
+        }
+        
+        /**
+         * Wakes up the threads which observe a kernel resource.
+         *
+         * The method is called by the resource which might have become not blocked,
+         * and the woken threads test their resources again. Interrupts are disabled
+         * only while one thread is being woken up.
+         *
+         * @param observers the observers queue of the resource.
+         */
+        void notifyObservers(ThreadQueue& observers)
+        {
+            while( not observers.isEmpty() )
+            {
+                bool is = Int::disableAll();
+                ThreadQueue::Node* node = observers.peek();
+                if(node != NULL) wakeThread(*node);
+                Int::enableAll(is);
+            }
+        }
+        
+        /**
+         * Locks switching of the executing thread.
+         *
+         * The lock is nestable, and switching which is requested while 
+         * the scheduler is locked is deferred till the last unlocking.
+         * The executing thread might still switch itself by yielding, 
+         * then the lock is kept by the thread till it is switched back.
+         * The method is inline, as it is the cheapest exclusion of threads 
+         * for kernel resources which are not changed in interrupts.
+         */
+        void lock()
+        {
+            lock_++;
+            barrier();
+        }
+        
+        /**
+         * Unlocks switching of the executing thread.
+         */
+        void unlock()
+        {
+            if(lock_ == 0) return;
+            barrier();
+            lock_--;
+            // The interrupt is set pending, so the method might be called in an interrupt context
+            if(lock_ == 0 && isPending_) set();
+        }
+        
         /**
          * Adds a thread to execution list
          *
@@ -93,8 +218,169 @@ namespace kernel
          * @param thread removing thread.
          */
         void removeThread(SchedulerThread* thread);        
+        
+        /**
+         * Removes a thread from the ready queue.
+         *
+         * The thread status must be set to blocked or waiting before calling.
+         * A blocked thread is added to the waiting list which resources are polled.
+         *
+         * @param thread suspending thread.
+         */
+        void suspendThread(SchedulerThread* thread);
+        
+        /**
+         * Moves a thread from the ready queue to the sleep queue.
+         *
+         * The thread status must be set to sleeping before calling,
+         * or to waiting if the thread waits for a resource with a timeout.
+         *
+         * @param thread sleeping thread.
+         * @param time   wake up time in nanoseconds.
+         */
+        void sleepThread(SchedulerThread* thread, int64 time);
+        
+        /**
+         * Moves a thread from the waiting list or the sleep queue to the ready queue.
+         *
+         * @param thread resuming thread.
+         */
+        void resumeThread(SchedulerThread* thread);
+        
+        /**
+         * Removes a node from its wait queue and resumes the node thread.
+         *
+         * The executing thread is preempted if the resumed thread has a higher priority.
+         *
+         * @param node a node of a kernel resource wait queue.
+         * @return true if the node thread was waiting and has been resumed.
+         */
+        bool wakeThread(ThreadQueue::Node& node);
+        
+        /**
+         * Sets the effective priority of a thread and moves it to the tail of its priority level.
+         *
+         * The method is called when a thread priority or waiters of mutexes it holds have been changed.
+         * The priority is inherited by owners of mutexes which the thread waits for transitively.
+         *
+         * @param thread reordering thread.
+         */
+        void reorderThread(SchedulerThread* thread);
   
     private:
+    
+        /**
+         * Task of the idle thread.
+         *
+         * The idle thread is executed when the ready queue is empty,
+         * it is never added to the queue and never counted.
+         */
+        class Idle : public ::api::Task
+        {
+        
+        public:
+        
+            /** 
+             * Constructor.
+             */
+            Idle(){}
+            
+            /** 
+             * Destructor.
+             */
+            virtual ~Idle(){}
+            
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */    
+            virtual bool isConstructed() const
+            {
+                return true;
+            }
+            
+            /**
+             * The method with self context.
+             */  
+            virtual void main()
+            {
+                while(true);
+            }
+            
+            /**
+             * Returns size of stack.
+             *
+             * @return stack size in bytes.
+             */  
+            virtual int32 getStackSize() const
+            {
+                return 0x200;
+            }
+        
+        };
+  
+        /**
+         * Toggle of the scheduler lock.
+         */
+        class Lock : public ::api::Toggle
+        {
+        
+        public:
+        
+            /** 
+             * Constructor.
+             *
+             * @param scheduler the scheduler.
+             */
+            Lock(Scheduler& scheduler) :
+                scheduler_ (scheduler){
+            }
+            
+            /** 
+             * Destructor.
+             */
+            virtual ~Lock(){}
+            
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */    
+            virtual bool isConstructed() const
+            {
+                return true;
+            }
+            
+            /** 
+             * Locks the scheduler.
+             *
+             * @return always true as the lock is nestable.
+             */ 
+            virtual bool disable()
+            {
+                scheduler_.lock();
+                return true;
+            }
+            
+            /** 
+             * Unlocks the scheduler.
+             *
+             * @param status returned status by disable method.
+             */    
+            virtual void enable(bool status)
+            {
+                if(status) scheduler_.unlock();
+            }
+            
+        private:
+        
+            /**
+             * The scheduler.
+             */
+            Scheduler& scheduler_;
+        
+        };
   
         /** 
          * Constructor.
@@ -106,7 +392,44 @@ namespace kernel
          * @return true if object has been constructed successfully.
          */
         bool construct();
+        
+        /**
+         * Adds a thread to the ready queue or to the deadline queue.
+         *
+         * An earliest deadline first thread which budget is exhausted 
+         * is moved to the sleep queue till its next period.
+         *
+         * @param thread a runnable thread.
+         */  
+        void addReady(SchedulerThread* thread);
+        
+        /**
+         * Removes a thread from the ready queue or from the deadline queue.
+         *
+         * @param thread a ready thread.
+         */  
+        void removeReady(SchedulerThread* thread);
 
+        /**
+         * Requests switching to a thread which has been made ready if it must be executed before the executing thread.
+         *
+         * @param thread a ready thread.
+         */  
+        void preempt(SchedulerThread* thread);
+        
+        /**
+         * Programs the scheduler timer for the executing thread.
+         *
+         * When the EOOS_TICKLESS macro is defined, the timer interrupt is requested
+         * only for a time slice end of the executing thread if other threads have
+         * the same priority, or for the earliest wake up of a sleeping thread,
+         * and the timer is stopped if no one of these events is expected.
+         *
+         * @param time current time in nanoseconds.
+         * @param poll true if a blocked thread exists which resource has to be polled.
+         */  
+        void setTimer(int64 time, bool poll);
+        
         /**
          * Runs a method of Runnable interface start vector.
          */  
@@ -116,7 +439,30 @@ namespace kernel
          * Runs a method of Runnable interface start vector.
          */  
         static void mainThread(Scheduler* scheduler);
-        
+
+        /**
+         * Keeps the accesses to locked resources between the lock counter changes.
+         *
+         * The inline lock does not call a function, so the compiler might move
+         * the accesses to resource fields, which are not volatile, over the counter.
+         */
+        static void barrier()
+        {
+            #if defined(__GNUC__)
+            __asm__ __volatile__("" ::: "memory");
+            #else
+            static void (* volatile const call)() = &Scheduler::fence;
+            call();
+            #endif
+        }
+
+        /**
+         * Does nothing being called as a barrier.
+         */
+        static void fence()
+        {
+        }
+
         /**
          * Copy constructor.
          *
@@ -143,9 +489,79 @@ namespace kernel
         const bool& isConstructed_;        
         
         /**
-         * The tasks list.
+         * The ready threads queue.
+         */
+        ReadyQueue ready_;
+        
+        /**
+         * The blocked threads list.
+         */
+        ThreadQueue wait_;
+        
+        /**
+         * The node which a tested kernel resource links to its observers, or NULL.
+         */
+        ThreadQueue::Node* observer_;
+        
+        /**
+         * The sleeping threads queue.
+         */
+        SleepQueue sleep_;
+        
+        /**
+         * The earliest deadline first threads queue ordered by absolute deadlines.
+         */
+        SleepQueue edf_;
+        
+        /**
+         * The executing thread.
+         */
+        SchedulerThread* current_;
+        
+        /**
+         * Time when the executing thread has been switched to in nanoseconds.
+         */
+        int64 dispatched_;
+        
+        /**
+         * The executing thread has yielded itself.
+         */
+        bool isYielded_;
+        
+        /**
+         * Lock counter of the executing thread.
+         */
+        volatile int32 lock_;
+        
+        /**
+         * Switching has been requested while the scheduler was locked.
+         */
+        volatile bool isPending_;
+        
+        /**
+         * The scheduler lock toggle.
+         */
+        Lock toggle_;
+        
+        /**
+         * The utilization of all earliest deadline first threads in parts of Reservation::UNIT.
+         */
+        int64 utilization_;
+        
+        /**
+         * The idle task.
+         */
+        Idle idleTask_;
+        
+        /**
+         * The idle thread.
+         */
+        SchedulerThread* idle_;
+        
+        /**
+         * Number of started and not dead threads.
          */
-        ::library::LinkedList< SchedulerThread* > list_;
+        int32 count_;
         
         /**
          * Counter of thread identifiers.
@@ -9,6 +9,10 @@
 #define KERNEL_SCHEDULER_THREAD_HPP_
 
 #include "kernel.Object.hpp"
+#include "kernel.Scheduler.hpp"
+#include "kernel.ThreadQueue.hpp"
+#include "kernel.SleepQueue.hpp"
+#include "kernel.Reservation.hpp"
 #include "api.Thread.hpp"
 #include "api.Task.hpp"
 #include "kernel.Kernel.hpp"
@@ -19,6 +23,8 @@
 
 namespace kernel
 {      
+    class Mutex;
+
     class SchedulerThread : public ::kernel::Object, public ::api::Thread
     {
         typedef ::kernel::Object         Parent;
@@ -43,9 +49,23 @@ namespace kernel
             task_          (&task),
             scheduler_     (scheduler),
             block_         (NULL),
+            node_          (*this),
+            join_          (),
             id_            (id),
             priority_      (NORM_PRIORITY),
-            sleep_         (0),
+            base_          (NORM_PRIORITY),
+            mutex_         (NULL),
+            owned_         (NULL),
+            sleep_         (*this),
+            reservation_   (*this),
+            runTime_       (0),
+            dispatchTime_  (-1),
+            voluntary_     (0),
+            involuntary_   (0),
+            lock_          (0),
+            isTimedOut_    (false),
+            notification_  (0),
+            notifyMask_    (0),
             status_        (NEW){
             setConstruct( construct(entry, scheduler) );
         }
@@ -79,10 +99,10 @@ namespace kernel
         {
             if( not isConstructed_ ) return;
             if( status_ != NEW ) return;
-            bool is = Int::disableAll();
-            scheduler_->addThread(this);
+            scheduler_->lock();
             status_ = RUNNABLE;  
-            Int::enableAll(is);              
+            if( not scheduler_->addThread(this) ) status_ = NEW;
+            scheduler_->unlock();              
         }       
         
         /**
@@ -91,10 +111,55 @@ namespace kernel
         virtual void join()
         {
             if( not isConstructed_ ) return; 
-            bool is = Int::disableAll();
-            // TODO: check that task has been added to the list
-            while(status_ != DEAD) scheduler_->yield();        
-            Int::enableAll(is);                
+            scheduler_->lock();
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if( status_ != DEAD && thread != this )
+            {
+                if(thread != NULL)
+                {
+                    // Wait till the scheduler wakes current thread up when this thread dies
+                    ThreadQueue::Node node(*thread);
+                    join_.add(node);
+                    thread->wait();
+                }
+                else
+                {
+                    // The boot context is not a thread, so it cannot wait and only yields
+                    while(status_ != DEAD) scheduler_->yield();        
+                }
+            }
+            scheduler_->unlock();                
+        }
+        
+        /**
+         * Waits for this thread to die within given time.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if this thread has died, or false if the time has elapsed.
+         */  
+        virtual bool join(int64 timeout)
+        {
+            if( not isConstructed_ ) return false; 
+            scheduler_->lock();
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if( status_ != DEAD && thread != this && timeout > 0 )
+            {
+                if(thread != NULL)
+                {
+                    ThreadQueue::Node node(*thread);
+                    join_.add(node);
+                    thread->wait(timeout);
+                    join_.remove(node);
+                }
+                else
+                {
+                    int64 time = Kernel::call().getExecutionTime().getValue() + timeout;
+                    while( status_ != DEAD && Kernel::call().getExecutionTime().getValue() < time ) scheduler_->yield();        
+                }
+            }
+            bool res = status_ == DEAD ? true : false;
+            scheduler_->unlock();                
+            return res;
         }
         
         /**
@@ -106,14 +171,14 @@ namespace kernel
         virtual void sleep(int64 millis, int32 nanos)
         {
             if( not isConstructed_ ) return;        
-            bool is = Int::disableAll();
+            scheduler_->lock();
             status_ = SLEEPING;            
             int64 t = Kernel::call().getExecutionTime().getValue();
             int64 m = millis * 1000000;
             int64 n = static_cast<int64>(nanos);
-            sleep_ = t + m + n;
+            scheduler_->sleepThread(this, t + m + n);
             scheduler_->yield();
-            Int::enableAll(is);        
+            scheduler_->unlock();        
         }
         
         /**
@@ -124,13 +189,132 @@ namespace kernel
         virtual void block(::api::Resource& res)
         {
             if( not isConstructed_ ) return;            
-            bool is = Int::disableAll();
+            scheduler_->lock();
             status_ = BLOCKED;
             block_ = &res;
+            scheduler_->suspendThread(this);
+            scheduler_->yield();
+            scheduler_->unlock();                
+        }        
+        
+        /**
+         * Blocks this thread on given resources till any of them is not blocked.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @return an index of the first resource which is not blocked, or -1 if error has been occurred.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count)
+        {
+            return block(resources, count, 0, false);
+        }        
+        
+        /**
+         * Blocks this thread on given resources till any of them is not blocked or given time elapses.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @param timeout   the maximum time to wait in nanoseconds.
+         * @return an index of the first resource which is not blocked, or -1 if the time has elapsed.
+         */  
+        virtual int32 block(::api::Resource* const* resources, int32 count, int64 timeout)
+        {
+            return block(resources, count, timeout, true);
+        }        
+        
+        /**
+         * Sets notification bits of this thread.
+         *
+         * @param bits the bits to set.
+         */  
+        virtual void notify(uint32 bits)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            notification_ |= bits;
+            // The waiting thread is woken up once, as the node of a woken thread 
+            // is linked to the ready queue or the sleep queue of the scheduler
+            if( (notification_ & notifyMask_) != 0 && status_ == WAITING )
+            {
+                notifyMask_ = 0;
+                scheduler_->wakeThread(node_);
+            }
+            Int::enableAll(is);
+        }
+        
+        /**
+         * Waits for any notification bit of given mask.
+         *
+         * @param mask the bits to wait for.
+         * @return the notification bits of the mask, or zero if error has been occurred.
+         */  
+        virtual uint32 waitNotification(uint32 mask)
+        {
+            return waitNotification(mask, 0, false);
+        }
+        
+        /**
+         * Waits for any notification bit of given mask within given time.
+         *
+         * @param mask    the bits to wait for.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return the notification bits of the mask, or zero if the time has elapsed.
+         */  
+        virtual uint32 waitNotification(uint32 mask, int64 timeout)
+        {
+            return waitNotification(mask, timeout, true);
+        }
+        
+        /**
+         * Causes this thread to wait until it is woken up by a kernel resource.
+         *
+         * The thread must be linked to a wait queue of the resource before 
+         * calling, and the resource wakes it up by the scheduler directly.
+         */  
+        void wait()
+        {
+            if( not isConstructed_ ) return;            
+            scheduler_->lock();
+            status_ = WAITING;
+            scheduler_->suspendThread(this);
             scheduler_->yield();
-            Int::enableAll(is);                
+            scheduler_->unlock();                
         }        
         
+        /**
+         * Causes this thread to wait until it is woken up by a kernel resource or given time elapses.
+         *
+         * The thread must be linked to a wait queue of the resource before calling,
+         * and the thread remains linked to the queue if the time has elapsed.
+         *
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the thread has been woken up by the resource, or false if the time has elapsed.
+         */  
+        bool wait(int64 timeout)
+        {
+            if( not isConstructed_ ) return false;            
+            scheduler_->lock();
+            int64 time = Kernel::call().getExecutionTime().getValue() + timeout;
+            status_ = WAITING;
+            isTimedOut_ = false;
+            // The scheduler wakes the thread up from its sleep queue if the resource does not do it in time
+            scheduler_->sleepThread(this, time);
+            scheduler_->yield();
+            bool res = isTimedOut_ ? false : true;
+            scheduler_->unlock();
+            return res;
+        }        
+        
+        /**
+         * Interrupts waiting of this thread for a kernel resource as the wait time has elapsed.
+         *
+         * The method is called by the scheduler only.
+         */  
+        void timeOut()
+        {
+            isTimedOut_ = true;
+        }
+        
         /**
          * Returns the identifier of this thread.
          *
@@ -144,6 +328,9 @@ namespace kernel
         /**
          * Returns this thread priority.
          *
+         * The priority might be higher than the set one while this thread 
+         * holds a mutex which higher priority threads wait for.
+         *
          * @return priority value, or -1 if error has been occurred.
          */  
         virtual int32 getPriority() const
@@ -159,16 +346,229 @@ namespace kernel
         virtual void setPriority(int32 priority)
         {
             if( not isConstructed_ ) return;
+            scheduler_->lock();
             if(priority == LOCK_PRIORITY)
-                priority_ = LOCK_PRIORITY;
+                base_ = LOCK_PRIORITY;
             else if(priority > MAX_PRIORITY) 
-                priority_ = MAX_PRIORITY;
+                base_ = MAX_PRIORITY;
             else if(priority < MIN_PRIORITY) 
-                priority_ = MIN_PRIORITY;
+                base_ = MIN_PRIORITY;
             else 
-                priority_ = priority;        
+                base_ = priority;        
+            scheduler_->reorderThread(this);
+            scheduler_->unlock();
         }
 
+        /**
+         * Sets this thread period.
+         *
+         * @param nanos the period in nanoseconds, or zero to reset periodic mode.
+         */  
+        virtual void setPeriod(int64 nanos)
+        {
+            if( not isConstructed_ ) return;
+            scheduler_->lock();
+            int64 time = Kernel::call().getExecutionTime().getValue();
+            reservation_.setPeriod(nanos, time);
+            scheduler_->unlock();
+        }
+        
+        /**
+         * Causes this thread to wait for the beginning of next period.
+         */  
+        virtual void waitNextPeriod()
+        {
+            if( not isConstructed_ ) return;
+            scheduler_->lock();
+            if( reservation_.isPeriodic() )
+            {
+                int64 time = Kernel::call().getExecutionTime().getValue();
+                status_ = SLEEPING;
+                scheduler_->sleepThread(this, reservation_.complete(time));
+                scheduler_->yield();
+            }
+            scheduler_->unlock();
+        }
+        
+        /**
+         * Returns a number of periods which this thread has overrun.
+         *
+         * @return number of overruns.
+         */  
+        virtual int32 getOverrunCount() const
+        {
+            return isConstructed_ ? reservation_.getOverrunCount() : 0;
+        }
+        
+        /**
+         * Returns a number of deadlines which this thread has missed.
+         *
+         * @return number of deadline misses.
+         */  
+        virtual int32 getMissCount() const
+        {
+            return isConstructed_ ? reservation_.getMissCount() : 0;
+        }
+        
+        /**
+         * Returns the processor time which this thread has been executed.
+         *
+         * @return time in nanoseconds.
+         */  
+        virtual int64 getRunTime() const
+        {
+            return isConstructed_ ? runTime_ : 0;
+        }
+        
+        /**
+         * Returns the time when this thread has been switched to last time.
+         *
+         * @return time in nanoseconds, or -1 if the thread has never been executed.
+         */  
+        virtual int64 getDispatchTime() const
+        {
+            return isConstructed_ ? dispatchTime_ : -1;
+        }
+        
+        /**
+         * Returns a number of switches from this thread which the thread has caused itself.
+         *
+         * @return number of voluntary switches.
+         */  
+        virtual int64 getVoluntarySwitchCount() const
+        {
+            return isConstructed_ ? voluntary_ : 0;
+        }
+        
+        /**
+         * Returns a number of switches from this thread which have preempted the thread.
+         *
+         * @return number of involuntary switches.
+         */  
+        virtual int64 getInvoluntarySwitchCount() const
+        {
+            return isConstructed_ ? involuntary_ : 0;
+        }
+        
+        /**
+         * Adds executed time to the processor time of this thread.
+         *
+         * @param time the executed time in nanoseconds.
+         */  
+        void charge(int64 time)
+        {
+            runTime_ += time;
+        }
+        
+        /**
+         * Counts switching to this thread.
+         *
+         * @param time current time in nanoseconds.
+         */  
+        void dispatch(int64 time)
+        {
+            dispatchTime_ = time;
+        }
+        
+        /**
+         * Counts switching from this thread.
+         *
+         * @param isVoluntary true if the thread has caused the switch itself.
+         */  
+        void countSwitch(bool isVoluntary)
+        {
+            if(isVoluntary)
+            {
+                voluntary_++;
+            }
+            else
+            {
+                involuntary_++;
+            }
+        }
+        
+        /**
+         * Returns the scheduler lock counter which this thread has been switched with.
+         *
+         * @return the lock counter.
+         */  
+        int32 getLock() const
+        {
+            return lock_;
+        }
+        
+        /**
+         * Sets the scheduler lock counter which this thread is switched with.
+         *
+         * @param lock the lock counter.
+         */  
+        void setLock(int32 lock)
+        {
+            lock_ = lock;
+        }
+        
+        /**
+         * Returns the set priority of this thread which is not raised by mutexes.
+         *
+         * @return priority value.
+         */  
+        int32 getBasePriority() const
+        {
+            return base_;
+        }
+        
+        /**
+         * Sets the priority which this thread is executed with.
+         *
+         * The method is called by the scheduler only.
+         *
+         * @param priority an effective priority.
+         */  
+        void setEffectivePriority(int32 priority)
+        {
+            priority_ = priority;
+        }
+        
+        /**
+         * Returns a mutex which this thread waits for.
+         *
+         * @return the mutex, or NULL if the thread does not wait for a mutex.
+         */  
+        Mutex* getMutex() const
+        {
+            return mutex_;
+        }
+        
+        /**
+         * Sets a mutex which this thread waits for.
+         *
+         * @param mutex the mutex, or NULL if the thread does not wait for a mutex.
+         */  
+        void setMutex(Mutex* mutex)
+        {
+            mutex_ = mutex;
+        }
+        
+        /**
+         * Returns the first mutex of a list of mutexes which this thread holds.
+         *
+         * @return the mutex, or NULL if the thread does not hold mutexes.
+         */  
+        Mutex* getOwned() const
+        {
+            return owned_;
+        }
+        
+        /**
+         * Sets the first mutex of a list of mutexes which this thread holds.
+         *
+         * @param mutex the mutex, or NULL if the thread does not hold mutexes.
+         */  
+        void setOwned(Mutex* mutex)
+        {
+            owned_ = mutex;
+        }
+        
         /**
          * Returns a status of this thread.
          *
@@ -196,17 +596,27 @@ namespace kernel
          */        
         int64 getSleep()
         {
-            return sleep_;
+            return sleep_.getTime();
         }
         
         /**
-         * Sets new status of this thread.
+         * Returns the sleep queue node of this thread.
+         *
+         * @return this thread node.
+         */        
+        SleepQueue::Node& getSleepNode()
+        {
+            return sleep_;
+        }        
+
+        /**
+         * Returns the processor time reservation of this thread.
          *
-         * @param new wake up time.
+         * @return the reservation which is set for earliest deadline first threads.
          */        
-        void setSleep(int64 sleep)
+        Reservation& getReservation()
         {
-            sleep_ = sleep;
+            return reservation_;
         }        
 
         /**
@@ -221,6 +631,26 @@ namespace kernel
             return block_;
         }
         
+        /**
+         * Returns the scheduler queues node of this thread.
+         *
+         * @return this thread node.
+         */        
+        ThreadQueue::Node& getNode()
+        {
+            return node_;
+        }
+        
+        /**
+         * Returns the queue of threads which wait for this thread to die.
+         *
+         * @return the queue.
+         */        
+        ThreadQueue& getJoinQueue()
+        {
+            return join_;
+        }
+        
         /**
          * Returns registers of this thread.
          *
@@ -247,6 +677,231 @@ namespace kernel
         
     private:
     
+        /**
+         * Node of this thread which observes one of several kernel resources.
+         */
+        class Observer
+        {
+        
+        public:
+        
+            /** 
+             * Constructor.
+             *
+             * @param thread the observing thread.
+             * @param iprev  the observer of the previous resource, or NULL.
+             */
+            Observer(SchedulerThread& thread, Observer* iprev) :
+                node (thread),
+                prev (iprev){
+            }
+            
+            /** 
+             * Destructor.
+             */
+           ~Observer(){}
+            
+            /**
+             * The node which is linked to observers of the resource.
+             */
+            ThreadQueue::Node node;
+            
+            /**
+             * The observer of the previous resource.
+             */
+            Observer* prev;
+        
+        };
+        
+        /**
+         * Resource which is blocked while all of several resources are blocked.
+         *
+         * The resource is polled by the scheduler for the resources
+         * which do not notify waiting threads about their changes.
+         */
+        class Resources : public ::api::Resource
+        {
+        
+        public:
+        
+            /** 
+             * Constructor.
+             *
+             * @param resources an array of resources.
+             * @param count     a number of the resources.
+             */
+            Resources(::api::Resource* const* resources, int32 count) :
+                resources_ (resources),
+                count_     (count){
+            }
+            
+            /** 
+             * Destructor.
+             */
+            virtual ~Resources(){}
+            
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */    
+            virtual bool isConstructed() const
+            {
+                return true;
+            }
+            
+            /** 
+             * Tests if this resource is blocked.
+             *
+             * @return true if all the resources are blocked.
+             */ 
+            virtual bool isBlocked()
+            {
+                for(int32 i=0; i<count_; i++)
+                {
+                    if( not resources_[i]->isBlocked() ) return false;
+                }
+                return true;
+            }
+            
+        private:
+        
+            /**
+             * The array of resources.
+             */
+            ::api::Resource* const* resources_;
+            
+            /**
+             * The number of the resources.
+             */
+            int32 count_;
+        
+        };
+    
+        /**
+         * Blocks this thread on given resources till any of them is not blocked.
+         *
+         * The resources are tested with interrupts enabled, and the scheduler lock
+         * keeps other threads from changing them meanwhile. Kernel resources wake
+         * up the thread when they might have become not blocked, and the set of
+         * resources which contains another resource is polled by the scheduler.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @param timeout   the maximum time to wait in nanoseconds.
+         * @param isTimed   true if the waiting is limited by the timeout.
+         * @return an index of the first resource which is not blocked, or -1 if no resource is not blocked.
+         */  
+        int32 block(::api::Resource* const* resources, int32 count, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ || resources == NULL || count <= 0 ) return -1;
+            if( scheduler_->getCurrent() != this ) return -1;
+            int64 time = Kernel::call().getExecutionTime().getValue() + timeout;
+            scheduler_->lock();
+            int32 res = RETEST;
+            while(res == RETEST)
+            {
+                res = observe(resources, count, 0, NULL, false, time, isTimed);
+                if(res != POLL) continue;
+                // The resources are tested by the scheduler on each its interrupt
+                Resources set(resources, count);
+                status_ = BLOCKED;
+                block_ = &set;
+                if(isTimed) scheduler_->sleepThread(this, time);
+                scheduler_->suspendThread(this);
+                scheduler_->yield();
+                block_ = NULL;
+                res = RETEST;
+            }
+            scheduler_->unlock();
+            return res;
+        }
+        
+        /**
+         * Tests resources from given one and observes them while they are blocked.
+         *
+         * The method recurses for each resource to keep the observer nodes on the stack,
+         * and the call for the last resource waits till any node is unlinked by its resource.
+         *
+         * @param resources an array of resources.
+         * @param count     a number of the resources.
+         * @param index     an index of the resource to test.
+         * @param prev      the observer of the previous resource, or NULL.
+         * @param isPolled  true if a previous resource does not notify observers.
+         * @param time      the time when the waiting is complete in nanoseconds.
+         * @param isTimed   true if the waiting is limited by the time.
+         * @return an index of the first resource which is not blocked, -1 if the time has elapsed,
+         *         RETEST if the resources have to be tested again, or POLL if they have to be polled.
+         */  
+        int32 observe(::api::Resource* const* resources, int32 count, int32 index, Observer* prev, bool isPolled, int64 time, bool isTimed)
+        {
+            if(index == count) return waitObserved(prev, isPolled, time, isTimed);
+            Observer observer(*this, prev);
+            scheduler_->setObserver(&observer.node);
+            bool isBlocked = resources[index]->isBlocked();
+            // The resource which has not linked the node does not notify observers
+            if( scheduler_->getObserver() != NULL ) isPolled = true;
+            scheduler_->setObserver(NULL);
+            int32 res = isBlocked ? observe(resources, count, index + 1, &observer, isPolled, time, isTimed) : index;
+            scheduler_->unobserve(observer.node);
+            return res;
+        }
+        
+        /**
+         * Waits till any resource unlinks a node of observers.
+         *
+         * @param last     the observer of the last resource.
+         * @param isPolled true if a resource does not notify observers.
+         * @param time     the time when the waiting is complete in nanoseconds.
+         * @param isTimed  true if the waiting is limited by the time.
+         * @return -1 if the time has elapsed, RETEST or POLL.
+         */  
+        int32 waitObserved(Observer* last, bool isPolled, int64 time, bool isTimed)
+        {
+            int64 timeout = time - Kernel::call().getExecutionTime().getValue();
+            if( isTimed && timeout <= 0 ) return -1;
+            if(isPolled) return POLL;
+            bool is = Int::disableAll();
+            // A resource which might have become not blocked after its testing has unlinked the node
+            bool isLinked = true;
+            for(Observer* observer = last; observer != NULL; observer = observer->prev)
+            {
+                if(observer->node.getQueue() == NULL) isLinked = false;
+            }
+            if(isLinked)
+            {
+                if(isTimed) wait(timeout);
+                else wait();
+            }
+            Int::enableAll(is);
+            return RETEST;
+        }
+    
+        /**
+         * Waits for any notification bit of given mask.
+         *
+         * @param mask    the bits to wait for.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return the notification bits of the mask, or zero if no bit has been set.
+         */  
+        uint32 waitNotification(uint32 mask, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ || mask == 0 ) return 0;
+            if( scheduler_->getCurrent() != this ) return 0;
+            bool is = Int::disableAll();
+            if( (notification_ & mask) == 0 && not (isTimed && timeout <= 0) )
+            {
+                notifyMask_ = mask;
+                if(isTimed) wait(timeout);
+                else wait();
+                notifyMask_ = 0;
+            }
+            uint32 res = notification_ & mask;
+            notification_ &= ~res;
+            return Int::enableAll(is, res);
+        }
+    
         /** 
          * Constructor.
          *
@@ -286,6 +941,16 @@ namespace kernel
          */
         SchedulerThread& operator =(const SchedulerThread& obj); 
 
+        /**
+         * The result of testing several resources which have to be tested again.
+         */
+        static const int32 RETEST = -2;
+        
+        /**
+         * The result of testing several resources which have to be polled by the scheduler.
+         */
+        static const int32 POLL = -3;
+        
         /** 
          * The root object constructed flag.
          */  
@@ -316,20 +981,92 @@ namespace kernel
          */        
         ::api::Resource* block_;        
         
+        /**
+         * Node of the scheduler queues.
+         */        
+        ThreadQueue::Node node_;
+        
+        /**
+         * Queue of threads which wait for this thread to die.
+         */        
+        ThreadQueue join_;
+        
         /**
          * Current identifier.
          */        
         int64 id_;
         
         /**
-         * Current priority.
+         * Current priority which this thread is executed with.
          */        
         int32 priority_;
         
         /**
-         * Wake up time in nanoseconds.
+         * Set priority.
+         */        
+        int32 base_;
+        
+        /**
+         * Mutex which this thread waits for.
+         */        
+        Mutex* mutex_;
+        
+        /**
+         * The first mutex of mutexes which this thread holds.
+         */        
+        Mutex* owned_;
+        
+        /**
+         * Node of the scheduler sleep queue which keeps wake up time in nanoseconds.
+         * The node is also used for waiting for the next period of this thread,
+         * and for the timeout of waiting for a kernel resource.
+         */        
+        SleepQueue::Node sleep_;    
+        
+        /**
+         * Processor time reservation of earliest deadline first thread.
+         */        
+        Reservation reservation_;
+        
+        /**
+         * Processor time which this thread has been executed in nanoseconds.
+         */        
+        int64 runTime_;
+        
+        /**
+         * Time of last switching to this thread in nanoseconds.
+         */        
+        int64 dispatchTime_;
+        
+        /**
+         * Number of voluntary switches from this thread.
+         */        
+        int64 voluntary_;
+        
+        /**
+         * Number of involuntary switches from this thread.
+         */        
+        int64 involuntary_;
+        
+        /**
+         * The scheduler lock counter of this thread while it is not executed.
+         */        
+        int32 lock_;
+        
+        /**
+         * The last waiting for a kernel resource has been interrupted by the timeout.
+         */        
+        bool isTimedOut_;
+        
+        /**
+         * Notification bits which have been set and have not been taken.
+         */        
+        uint32 notification_;
+        
+        /**
+         * Notification bits which this thread waits for, or zero if it does not wait.
          */        
-        int64 sleep_;    
+        uint32 notifyMask_;
         
         /**
          * Current status.
@@ -12,13 +12,15 @@
 #include "api.Semaphore.hpp"
 #include "api.Thread.hpp"
 #include "kernel.Kernel.hpp"
-#include "library.LinkedList.hpp"
+#include "kernel.SchedulerThread.hpp"
+#include "module.Interrupt.hpp"
 
 namespace kernel
 {
     class Semaphore : public ::kernel::Object, public ::api::Semaphore
     {
-        typedef ::kernel::Object Parent;
+        typedef ::kernel::Object    Parent;
+        typedef ::module::Interrupt Int;
      
     public:
   
@@ -30,10 +32,10 @@ namespace kernel
         Semaphore(int32 permits) : Parent(),
             isConstructed_ (getConstruct()),
             scheduler_     (NULL),
-            thread_        (NULL),            
             permits_       (permits),
             isFair_        (false),    
-            fifo_          (NULL){
+            fifo_          (),
+            observers_     (){
             setConstruct( construct() );  
         }
         
@@ -46,10 +48,10 @@ namespace kernel
         Semaphore(int32 permits, bool isFair) : Parent(),
             isConstructed_ (getConstruct()),  
             scheduler_     (NULL),
-            thread_        (NULL),              
             permits_       (permits),
             isFair_        (isFair),
-            fifo_          (NULL){
+            fifo_          (),
+            observers_     (){
             setConstruct( construct() );  
         }
 
@@ -88,55 +90,42 @@ namespace kernel
          */  
         virtual bool acquire(int32 permits)
         {
-            if( not isConstructed_ ) return false;
-            bool is = thread_->disable();
-            ::api::Thread& thread = scheduler_->getCurrentThread();
-            // Acquire fairly
-            if(isFair_)
-            {
-                // The first checking for acquiring available permits of the semaphore
-                if( permits_ - permits >= 0 && fifo_.isEmpty() )
-                {
-                    // Decrement the number of available permits
-                    permits_ -= permits;
-                    // Go through the semaphore to critical section
-                    return thread_->enable(is, true);      
-                }
-                // Add current thread to the queue tail
-                if( fifo_.add(&thread) == false ) return thread_->enable(is, false);
-                while(true)
-                {
-                    // Block current thread on the semaphore and switch to another thread
-                    thread.block(*this);
-                    // Test if head thread is current thread
-                    if(fifo_.peek() != &thread) continue;
-                    // Test available permits for no breaking the fifo queue by removing
-                    if(permits_ - permits < 0) continue;
-                    // Decrement the number of available permits
-                    permits_ -= permits;        
-                    // Remove head thread
-                    return thread_->enable( is, fifo_.remove() );
-                }    
-            }
-            // Acquire unfairly
-            else
-            {
-                while(true)
-                {
-                    // Check about available permits in the semaphoring critical section
-                    if( permits_ - permits >= 0 )
-                    {
-                        // Decrement the number of available permits
-                        permits_ -= permits;
-                        // Go through the semaphore to critical section
-                        return thread_->enable(is, true);
-                    }
-                    // Block current thread on the semaphore and switch to another thread
-                    thread.block(*this);      
-                }  
-            }
+            return acquire(permits, 0, false);
         }        
         
+        /**
+         * Acquires the given number of permits from this semaphore within given time.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @return true if the semaphore is acquired successfully, or false if the time has elapsed.
+         */  
+        virtual bool acquire(int32 permits, int64 timeout)
+        {
+            return acquire(permits, timeout, true);
+        }
+        
+        /**
+         * Acquires one permit from this semaphore only if it is available.
+         *
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire()
+        {
+            return acquire(1, 0, true);
+        }
+        
+        /**
+         * Acquires the given number of permits from this semaphore only if they are available.
+         *
+         * @param permits the number of permits to acquire.
+         * @return true if the semaphore is acquired successfully.
+         */  
+        virtual bool tryAcquire(int32 permits)
+        {
+            return acquire(permits, 0, true);
+        }
+        
         /**
          * Releases one permit.
          */
@@ -153,9 +142,13 @@ namespace kernel
         virtual void release(int32 permits)
         {
             if( not isConstructed_ ) return;
-            bool is = thread_->disable();
+            // Woken threads are switched to after all of them have been resumed
+            scheduler_->lock();
+            bool is = Int::disableAll();
             permits_ += permits;
-            thread_->enable(is);
+            Int::enableAll(is);
+            handOver();
+            scheduler_->unlock();
         }  
         
         /**
@@ -176,12 +169,111 @@ namespace kernel
         virtual bool isBlocked()
         {
             if( not isConstructed_ ) return false;
-            bool is = thread_->disable();
+            bool is = Int::disableAll();
+            // A thread which waits for several resources is notified of released permits
+            scheduler_->observe(observers_);
             bool res = permits_ > 0 ? false : true;
-            return thread_->enable(is, res);
+            return Int::enableAll(is, res);
         }
   
     private:   
+    
+        /**
+         * Acquires the given number of permits from this semaphore.
+         *
+         * @param permits the number of permits to acquire.
+         * @param timeout the maximum time to wait in nanoseconds.
+         * @param isTimed true if the waiting is limited by the timeout.
+         * @return true if the semaphore is acquired successfully.
+         */  
+        bool acquire(int32 permits, int64 timeout, bool isTimed)
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            // The fair semaphore is not acquired while other threads wait for it
+            if( permits_ - permits >= 0 && (not isFair_ || fifo_.isEmpty()) )
+            {
+                // Decrement the number of available permits
+                permits_ -= permits;
+                // Go through the semaphore to critical section
+                return Int::enableAll(is, true);
+            }
+            if( isTimed && timeout <= 0 ) return Int::enableAll(is, false);
+            // Only threads might wait for the permits
+            SchedulerThread* thread = scheduler_->getCurrent();
+            if(thread == NULL) return Int::enableAll(is, false);
+            // Add current thread to the queue tail and switch to another thread.
+            // The permits are handed over by a releasing thread which unlinks
+            // the node before it wakes this one.
+            ThreadQueue::Node node(*thread);
+            node.value = permits;
+            fifo_.add(node);
+            if(isTimed) thread->wait(timeout);
+            else thread->wait();
+            // The permits might have been handed over right before the time has elapsed
+            bool res = node.getQueue() == NULL ? true : false;
+            if( not res ) fifo_.remove(node);
+            Int::enableAll(is);
+            if( not res )
+            {
+                // The timed out thread might have kept the next threads of the fair semaphore waiting
+                scheduler_->lock();
+                handOver();
+                scheduler_->unlock();
+            }
+            return res;
+        }
+        
+        /**
+         * Hands available permits over to waiting threads.
+         *
+         * The method is called with the scheduler locked, and interrupts are 
+         * disabled only while the permits of one thread are being granted.
+         */  
+        void handOver()
+        {
+            while(true)
+            {
+                bool is = Int::disableAll();
+                ThreadQueue::Node* node = grant();
+                Int::enableAll(is);
+                if(node == NULL) break;
+                scheduler_->wakeThread(*node);
+            }
+            // The threads which wait for several resources test the permits again
+            if(permits_ > 0) scheduler_->notifyObservers(observers_);
+        }
+        
+        /**
+         * Grants available permits to the first waiting thread which they suffice for.
+         *
+         * The permits are charged to the thread and its node is unlinked from the queue,
+         * so the thread has got the permits even if its time elapses before it is woken up.
+         *
+         * @return the unlinked node of the thread, or NULL if no thread has been granted.
+         */  
+        ThreadQueue::Node* grant()
+        {
+            ThreadQueue::Node* node = fifo_.peek();
+            while(node != NULL)
+            {
+                ThreadQueue::Node* next = node->getNext() != fifo_.peek() ? node->getNext() : NULL;
+                // A timed out thread which has not removed its node yet is skipped
+                if( node->getThread().getStatus() == ::api::Thread::WAITING )
+                {
+                    if( permits_ - node->value >= 0 )
+                    {
+                        permits_ -= node->value;
+                        fifo_.remove(*node);
+                        return node;
+                    }
+                    // The fair semaphore does not break the FIFO order
+                    if(isFair_) break;
+                }
+                node = next;
+            }
+            return NULL;
+        }
         
         /**
          * Constructor.
@@ -191,9 +283,7 @@ namespace kernel
         bool construct()
         {
             if( not isConstructed_ ) return false;
-            if( not fifo_.isConstructed() ) return false;
-            scheduler_ = &Kernel::call().getScheduler();
-            thread_ = &scheduler_->toggle();
+            scheduler_ = &static_cast< ::kernel::Scheduler& >( Kernel::call().getScheduler() );
             return true;
         }        
         
@@ -220,12 +310,7 @@ namespace kernel
         /**
          * The kernel threads scheduler.
          */        
-        ::api::Scheduler* scheduler_;
-        
-        /**
-         * The kernel threads switching toggle.
-         */        
-        ::api::Toggle* thread_;
+        ::kernel::Scheduler* scheduler_;
         
         /**
          * Number of permits for acquiring this semaphore.
@@ -238,9 +323,14 @@ namespace kernel
         bool isFair_;
         
         /** 
-         * Queue of locked threads.
+         * Queue of waiting threads.
          */     
-        ::library::LinkedList< ::api::Thread* > fifo_;
+        ThreadQueue fifo_;
+        
+        /**
+         * Queue of threads which wait for any of several resources.
+         */
+        ThreadQueue observers_;
   
     };  
 }
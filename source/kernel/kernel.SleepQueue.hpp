@@ -0,0 +1,323 @@
+/**
+ * Sleep queue of the scheduler.
+ *
+ * The queue is a binary min-heap of nodes ordered by wake up time,
+ * so the earliest sleeping thread is got for constant time, and a thread
+ * is added or removed for logarithmic time. The heap memory is reserved
+ * beforehand, therefore the queue might be changed in an interrupt context.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_SLEEP_QUEUE_HPP_
+#define KERNEL_SLEEP_QUEUE_HPP_
+
+#include "kernel.Allocator.hpp"
+#include "module.Interrupt.hpp"
+
+namespace kernel
+{
+    class SchedulerThread;
+
+    class SleepQueue
+    {
+        typedef ::module::Interrupt Int;
+
+    public:
+
+        /**
+         * Node of sleep queues.
+         */
+        class Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param thread a thread which is linked by this node.
+             */
+            Node(SchedulerThread& thread) :
+                time_   (0),
+                index_  (-1),
+                thread_ (&thread){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Node()
+            {
+            }
+
+            /**
+             * Returns a thread of this node.
+             *
+             * @return the thread.
+             */
+            SchedulerThread& getThread() const
+            {
+                return *thread_;
+            }
+
+            /**
+             * Returns wake up time.
+             *
+             * @return time in nanoseconds.
+             */
+            int64 getTime() const
+            {
+                return time_;
+            }
+
+            /**
+             * Tests if this node is linked to a queue.
+             *
+             * @return true if this node is linked.
+             */
+            bool isLinked() const
+            {
+                return index_ >= 0 ? true : false;
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj reference to source object.
+             */
+            Node(const Node& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj reference to source object.
+             * @return reference to this object.
+             */
+            Node& operator =(const Node& obj);
+
+            /**
+             * Wake up time in nanoseconds.
+             */
+            int64 time_;
+
+            /**
+             * Index of this node in the heap, or -1 if it is not linked.
+             */
+            int32 index_;
+
+            /**
+             * Linked thread.
+             */
+            SchedulerThread* thread_;
+
+            friend class SleepQueue;
+
+        };
+
+        /**
+         * Constructor.
+         */
+        SleepQueue() :
+            heap_     (NULL),
+            capacity_ (0),
+            length_   (0){
+        }
+
+        /**
+         * Destructor.
+         */
+       ~SleepQueue()
+        {
+            ::kernel::Allocator::free(heap_);
+        }
+
+        /**
+         * Reserves memory for given number of nodes.
+         *
+         * The method allocates memory, so it must not be called in an interrupt context.
+         *
+         * @param count a number of nodes.
+         * @return true if the memory has been reserved.
+         */
+        bool reserve(int32 count)
+        {
+            if(count <= capacity_) return true;
+            int32 capacity = capacity_ != 0 ? capacity_ : INITIAL_CAPACITY;
+            while(capacity < count) capacity = capacity << 1;
+            void* addr = ::kernel::Allocator::allocate( capacity * sizeof(Node*) );
+            if(addr == NULL) return false;
+            Node** heap = reinterpret_cast<Node**>(addr);
+            bool is = Int::disableAll();
+            // Other thread might reserve more memory while this one was allocating
+            if(capacity > capacity_)
+            {
+                for(int32 i=0; i<length_; i++) heap[i] = heap_[i];
+                Node** old = heap_;
+                heap_ = heap;
+                heap = old;
+                capacity_ = capacity;
+            }
+            Int::enableAll(is);
+            ::kernel::Allocator::free(heap);
+            return true;
+        }
+
+        /**
+         * Inserts a node to this queue.
+         *
+         * @param node a unlinked node.
+         * @param time wake up time in nanoseconds.
+         * @return true if the node has been inserted.
+         */
+        bool add(Node& node, int64 time)
+        {
+            if(node.index_ >= 0 || length_ >= capacity_) return false;
+            node.time_ = time;
+            node.index_ = length_++;
+            heap_[node.index_] = &node;
+            siftUp(node.index_);
+            return true;
+        }
+
+        /**
+         * Removes a node from this queue.
+         *
+         * @param node a node of this queue.
+         */
+        void remove(Node& node)
+        {
+            int32 index = node.index_;
+            if(index < 0 || index >= length_ || heap_[index] != &node) return;
+            node.index_ = -1;
+            length_--;
+            if(index == length_) return;
+            // Put the last node to the place of removed one and restore the heap order
+            heap_[index] = heap_[length_];
+            heap_[index]->index_ = index;
+            if( index > 0 && heap_[index]->time_ < heap_[parent(index)]->time_ )
+            {
+                siftUp(index);
+            }
+            else
+            {
+                siftDown(index);
+            }
+        }
+
+        /**
+         * Returns the node with the earliest wake up time.
+         *
+         * @return the node, or NULL if this queue is empty.
+         */
+        Node* peek() const
+        {
+            return length_ != 0 ? heap_[0] : NULL;
+        }
+
+        /**
+         * Tests if this queue has no nodes.
+         *
+         * @return true if this queue contains no nodes.
+         */
+        bool isEmpty() const
+        {
+            return length_ == 0 ? true : false;
+        }
+
+    private:
+
+        /**
+         * Returns index of parent node.
+         *
+         * @param index a node index.
+         * @return the parent index.
+         */
+        static int32 parent(int32 index)
+        {
+            return (index - 1) >> 1;
+        }
+
+        /**
+         * Moves a node to the root while it is earlier than its parent.
+         *
+         * @param index a node index.
+         */
+        void siftUp(int32 index)
+        {
+            Node* node = heap_[index];
+            while(index > 0)
+            {
+                int32 p = parent(index);
+                if( heap_[p]->time_ <= node->time_ ) break;
+                heap_[index] = heap_[p];
+                heap_[index]->index_ = index;
+                index = p;
+            }
+            heap_[index] = node;
+            node->index_ = index;
+        }
+
+        /**
+         * Moves a node to the leafs while it is later than its children.
+         *
+         * @param index a node index.
+         */
+        void siftDown(int32 index)
+        {
+            Node* node = heap_[index];
+            while(true)
+            {
+                int32 c = (index << 1) + 1;
+                if(c >= length_) break;
+                if( c + 1 < length_ && heap_[c + 1]->time_ < heap_[c]->time_ ) c++;
+                if( node->time_ <= heap_[c]->time_ ) break;
+                heap_[index] = heap_[c];
+                heap_[index]->index_ = index;
+                index = c;
+            }
+            heap_[index] = node;
+            node->index_ = index;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SleepQueue(const SleepQueue& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SleepQueue& operator =(const SleepQueue& obj);
+
+        /**
+         * Initial number of nodes the memory is reserved for.
+         */
+        static const int32 INITIAL_CAPACITY = 8;
+
+        /**
+         * The heap of nodes.
+         */
+        Node** heap_;
+
+        /**
+         * Number of nodes the memory is reserved for.
+         */
+        int32 capacity_;
+
+        /**
+         * Number of nodes in the heap.
+         */
+        int32 length_;
+
+    };
+}
+#endif // KERNEL_SLEEP_QUEUE_HPP_
@@ -0,0 +1,157 @@
+/**
+ * Software interrupt resource.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_SOFTWARE_INTERRUPT_HPP_
+#define KERNEL_SOFTWARE_INTERRUPT_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.Interrupt.hpp"
+#include "kernel.SoftwareInterruptDispatcher.hpp"
+
+namespace kernel
+{
+    class SoftwareInterrupt : public ::kernel::Object, public ::api::Interrupt
+    {
+        typedef ::kernel::Object                      Parent;
+        typedef ::kernel::SoftwareInterruptDispatcher Dispatcher;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param dispatcher the software interrupts dispatcher.
+         * @param handler    user class which implements an interrupt handler interface.
+         * @param priority   a priority of the interrupt.
+         */
+        SoftwareInterrupt(Dispatcher& dispatcher, ::api::Task& handler, int32 priority) : Parent(),
+            isConstructed_ (getConstruct()),
+            dispatcher_    (dispatcher),
+            node_          (handler, priority){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~SoftwareInterrupt()
+        {
+            if( not isConstructed_ ) return;
+            dispatcher_.remove(node_);
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Posts this interrupt and runs the pending interrupts.
+         */
+        virtual void jump()
+        {
+            if( not isConstructed_ ) return;
+            dispatcher_.post(node_);
+            dispatcher_.jump();
+        }
+
+        /**
+         * Cancels a posting of this interrupt.
+         */
+        virtual void clear()
+        {
+            if( not isConstructed_ ) return;
+            dispatcher_.cancel(node_);
+        }
+
+        /**
+         * Posts this interrupt.
+         *
+         * The interrupt handler will be run after interrupt handlers
+         * which are being executed return, and before threads are resumed.
+         */
+        virtual void set()
+        {
+            if( not isConstructed_ ) return;
+            dispatcher_.post(node_);
+        }
+
+        /**
+         * Locks this interrupt.
+         *
+         * @return an interrupt enable bit value before method was called.
+         */
+        virtual bool disable()
+        {
+            if( not isConstructed_ ) return false;
+            return dispatcher_.disable(node_);
+        }
+
+        /**
+         * Unlocks this interrupt.
+         *
+         * @param status returned status by lock method.
+         */
+        virtual void enable(bool status)
+        {
+            if( not isConstructed_ ) return;
+            dispatcher_.enable(node_, status);
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            if( not dispatcher_.isConstructed() ) return false;
+            if( node_.priority < Dispatcher::MIN_PRIORITY || Dispatcher::MAX_PRIORITY < node_.priority ) return false;
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SoftwareInterrupt(const SoftwareInterrupt& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SoftwareInterrupt& operator =(const SoftwareInterrupt& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The software interrupts dispatcher.
+         */
+        Dispatcher& dispatcher_;
+
+        /**
+         * The node of this interrupt.
+         */
+        Dispatcher::Node node_;
+
+    };
+}
+#endif // KERNEL_SOFTWARE_INTERRUPT_HPP_
@@ -0,0 +1,385 @@
+/**
+ * Dispatcher of software interrupts.
+ *
+ * The dispatcher is the handler of one hardware interrupt source which is set
+ * by software only. Posted software interrupts are queued by their priorities,
+ * and the dispatcher runs them to completion in order of the priorities when
+ * the source interrupt is taken. Thus, the software interrupts are executed
+ * after the hardware interrupt which has posted them returns, before threads
+ * are resumed, and all of them use the one stack of the source interrupt context.
+ *
+ * The handlers are run with maskable interrupts enabled, so hardware interrupts
+ * preempt them, while the source interrupt is disabled and a posting of a running
+ * dispatcher only queues the interrupt. Threads are not switched till all the 
+ * pending software interrupts run, as the dispatcher locks the scheduler.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_SOFTWARE_INTERRUPT_DISPATCHER_HPP_
+#define KERNEL_SOFTWARE_INTERRUPT_DISPATCHER_HPP_
+
+#include "kernel.Interrupt.hpp"
+#include "kernel.ReadyQueue.hpp"
+#include "api.Task.hpp"
+#include "api.Toggle.hpp"
+
+namespace kernel
+{
+    class SoftwareInterruptDispatcher : public ::kernel::Interrupt, public ::api::Task
+    {
+        typedef ::kernel::Interrupt Parent;
+        typedef ::module::Interrupt Int;
+
+    public:
+
+        /**
+         * The maximum priority of software interrupts.
+         */
+        static const int32 MAX_PRIORITY = 31;
+
+        /**
+         * The minimum priority of software interrupts.
+         */
+        static const int32 MIN_PRIORITY = 0;
+
+        /**
+         * Node of a software interrupt.
+         */
+        class Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param ihandler  a task which is run when the interrupt is dispatched.
+             * @param ipriority a priority of the interrupt.
+             */
+            Node(::api::Task& ihandler, int32 ipriority) :
+                handler   (ihandler),
+                priority  (ipriority),
+                next      (NULL),
+                isPending (false),
+                isQueued  (false),
+                isEnabled (true){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Node(){}
+
+            /**
+             * The task of the interrupt.
+             */
+            ::api::Task& handler;
+
+            /**
+             * The priority of the interrupt.
+             */
+            int32 priority;
+
+            /**
+             * The next node of the same priority level.
+             */
+            Node* next;
+
+            /**
+             * The interrupt has been posted and has not been run.
+             */
+            bool isPending;
+
+            /**
+             * The node is contained in a priority level.
+             */
+            bool isQueued;
+
+            /**
+             * The interrupt might be dispatched.
+             */
+            bool isEnabled;
+
+        };
+
+        /**
+         * Constructor.
+         *
+         * @param source an interrupt source which is set by software only.
+         * @param toggle a toggle of thread switching.
+         */
+        SoftwareInterruptDispatcher(int32 source, ::api::Toggle& toggle) : Parent(),
+            isConstructed_ (getConstruct()),
+            toggle_        (toggle),
+            isRunning_     (false),
+            map_           (0){
+            for(int32 i=0; i<LEVELS; i++)
+            {
+                head_[i] = NULL;
+                tail_[i] = NULL;
+            }
+            setConstruct( construct(source) );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~SoftwareInterruptDispatcher()
+        {
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Hardware interrupt handler.
+         *
+         * The method runs the pending software interrupts
+         * from the highest priority till none of them is left.
+         */
+        virtual void main()
+        {
+            bool is = Int::disableAll();
+            if(isRunning_) 
+            {
+                Int::enableAll(is);
+                return;
+            }
+            isRunning_ = true;
+            // The context of the source interrupt is kept till the dispatcher returns
+            bool source = Parent::disable();
+            bool lock = toggle_.disable();
+            while(map_ != 0)
+            {
+                int32 level = 31 - ReadyQueue::countLeadingZeros(map_);
+                Node* node = head_[level];
+                unlink(*node);
+                node->isPending = false;
+                Int::enableAll(true);
+                node->handler.main();
+                Int::disableAll();
+            }
+            toggle_.enable(lock);
+            isRunning_ = false;
+            // The interrupts posted meanwhile have been run
+            clear();
+            Parent::enable(source);
+            Int::enableAll(is);
+        }
+
+        /**
+         * Returns size of stack.
+         *
+         * The stack is shared by all software interrupts.
+         *
+         * @return stack size in bytes.
+         */
+        virtual int32 getStackSize() const
+        {
+            return STACK_SIZE;
+        }
+
+        /**
+         * Posts a software interrupt.
+         *
+         * @param node a node of the interrupt.
+         */
+        void post(Node& node)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            node.isPending = true;
+            if( node.isEnabled && not node.isQueued )
+            {
+                link(node);
+                if( not isRunning_ ) set();
+            }
+            Int::enableAll(is);
+        }
+
+        /**
+         * Cancels a posted software interrupt.
+         *
+         * @param node a node of the interrupt.
+         */
+        void cancel(Node& node)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            node.isPending = false;
+            if(node.isQueued) unlink(node);
+            Int::enableAll(is);
+        }
+
+        /**
+         * Disables dispatching of a software interrupt.
+         *
+         * A posting of the interrupt stays pending till it is enabled.
+         *
+         * @param node a node of the interrupt.
+         * @return the enable status of the interrupt before method was called.
+         */
+        bool disable(Node& node)
+        {
+            if( not isConstructed_ ) return false;
+            bool is = Int::disableAll();
+            bool res = node.isEnabled;
+            node.isEnabled = false;
+            if(node.isQueued) unlink(node);
+            return Int::enableAll(is, res);
+        }
+
+        /**
+         * Enables dispatching of a software interrupt.
+         *
+         * @param node   a node of the interrupt.
+         * @param status returned status by disable method.
+         */
+        void enable(Node& node, bool status)
+        {
+            if( not isConstructed_ || not status ) return;
+            bool is = Int::disableAll();
+            node.isEnabled = true;
+            if( node.isPending && not node.isQueued )
+            {
+                link(node);
+                if( not isRunning_ ) set();
+            }
+            Int::enableAll(is);
+        }
+
+        /**
+         * Removes a software interrupt from this dispatcher.
+         *
+         * @param node a node of the interrupt.
+         */
+        void remove(Node& node)
+        {
+            disable(node);
+            cancel(node);
+        }
+
+    private:
+
+        /**
+         * Inserts a node to the tail of its priority level.
+         *
+         * @param node a unlinked node.
+         */
+        void link(Node& node)
+        {
+            int32 level = node.priority;
+            node.next = NULL;
+            if(tail_[level] == NULL) head_[level] = &node;
+            else tail_[level]->next = &node;
+            tail_[level] = &node;
+            node.isQueued = true;
+            map_ |= static_cast<uint32>(1) << level;
+        }
+
+        /**
+         * Removes a node from its priority level.
+         *
+         * @param node a linked node.
+         */
+        void unlink(Node& node)
+        {
+            int32 level = node.priority;
+            Node* prev = NULL;
+            Node* curr = head_[level];
+            while(curr != &node)
+            {
+                prev = curr;
+                curr = curr->next;
+            }
+            if(prev == NULL) head_[level] = node.next;
+            else prev->next = node.next;
+            if(tail_[level] == &node) tail_[level] = prev;
+            if(head_[level] == NULL) map_ &= ~(static_cast<uint32>(1) << level);
+            node.next = NULL;
+            node.isQueued = false;
+        }
+
+        /**
+         * Constructor.
+         *
+         * @param source an interrupt source which is set by software only.
+         * @return true if object has been constructed successfully.
+         */
+        bool construct(int32 source)
+        {
+            if( not isConstructed_ ) return false;
+            if(source < 0) return false;
+            if( not setHandler(*this, source) ) return false;
+            clear();
+            Parent::enable(true);
+            return true;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SoftwareInterruptDispatcher(const SoftwareInterruptDispatcher& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SoftwareInterruptDispatcher& operator =(const SoftwareInterruptDispatcher& obj);
+
+        /**
+         * Size of the shared stack in bytes.
+         */
+        static const int32 STACK_SIZE = 0x1000;
+
+        /**
+         * Number of priority levels.
+         */
+        static const int32 LEVELS = MAX_PRIORITY + 1;
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The toggle of thread switching.
+         */
+        ::api::Toggle& toggle_;
+
+        /**
+         * The pending software interrupts are being run.
+         */
+        bool isRunning_;
+
+        /**
+         * Bitmap of non-empty priority levels.
+         */
+        uint32 map_;
+
+        /**
+         * Head nodes of priority levels.
+         */
+        Node* head_[LEVELS];
+
+        /**
+         * Tail nodes of priority levels.
+         */
+        Node* tail_[LEVELS];
+
+    };
+}
+#endif // KERNEL_SOFTWARE_INTERRUPT_DISPATCHER_HPP_
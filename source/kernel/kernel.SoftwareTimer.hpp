@@ -0,0 +1,144 @@
+/**
+ * Software timer resource.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_SOFTWARE_TIMER_HPP_
+#define KERNEL_SOFTWARE_TIMER_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.SoftwareTimer.hpp"
+#include "kernel.TimerService.hpp"
+
+namespace kernel
+{
+    class SoftwareTimer : public ::kernel::Object, public ::api::SoftwareTimer
+    {
+        typedef ::kernel::Object Parent;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param service the software timers service.
+         * @param handler user class which implements a timer handler interface.
+         */
+        SoftwareTimer(TimerService& service, ::api::Task& handler) : Parent(),
+            isConstructed_ (getConstruct()),
+            service_       (service),
+            node_          (handler){
+            setConstruct( construct() );
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~SoftwareTimer()
+        {
+            service_.stop(node_);
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Starts this timer for one expiration.
+         *
+         * @param delay the time to expiration in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay)
+        {
+            if( not isConstructed_ ) return false;
+            return service_.start(node_, delay, 0);
+        }
+
+        /**
+         * Starts this timer for periodic expirations.
+         *
+         * @param delay  the time to first expiration in nanoseconds.
+         * @param period the time between expirations in nanoseconds.
+         * @return true if the timer has been started.
+         */
+        virtual bool start(int64 delay, int64 period)
+        {
+            if( not isConstructed_ || period <= 0 ) return false;
+            return service_.start(node_, delay, period);
+        }
+
+        /**
+         * Stops this timer.
+         */
+        virtual void stop()
+        {
+            if( not isConstructed_ ) return;
+            service_.stop(node_);
+        }
+
+        /**
+         * Tests if this timer is started.
+         *
+         * @return true if this timer waits for an expiration.
+         */
+        virtual bool isActive() const
+        {
+            if( not isConstructed_ ) return false;
+            return node_.list != NULL ? true : false;
+        }
+
+    private:
+
+        /**
+         * Constructor.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        bool construct()
+        {
+            if( not isConstructed_ ) return false;
+            return service_.initialize();
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        SoftwareTimer(const SoftwareTimer& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        SoftwareTimer& operator =(const SoftwareTimer& obj);
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * The software timers service.
+         */
+        TimerService& service_;
+
+        /**
+         * The node of this timer.
+         */
+        TimerService::Node node_;
+
+    };
+}
+#endif // KERNEL_SOFTWARE_TIMER_HPP_
@@ -0,0 +1,294 @@
+/**
+ * Intrusive queue of scheduler threads.
+ *
+ * The queue links nodes which are owned by threads or are placed
+ * on stacks of waiting threads, therefore the queue never allocates
+ * memory and all its operations might be done in an interrupt context.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_THREAD_QUEUE_HPP_
+#define KERNEL_THREAD_QUEUE_HPP_
+
+#include "Types.hpp"
+
+namespace kernel
+{
+    class SchedulerThread;
+
+    class ThreadQueue
+    {
+
+    public:
+
+        /**
+         * Node of thread queues.
+         */
+        class Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param thread a thread which is linked by this node.
+             */
+            Node(SchedulerThread& thread) :
+                value   (0),
+                prev_   (this),
+                next_   (this),
+                queue_  (NULL),
+                thread_ (&thread){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Node()
+            {
+                if(queue_ != NULL) queue_->remove(*this);
+            }
+
+            /**
+             * Returns a thread of this node.
+             *
+             * @return the thread.
+             */
+            SchedulerThread& getThread() const
+            {
+                return *thread_;
+            }
+
+            /**
+             * Returns a queue which contains this node.
+             *
+             * @return the queue, or NULL if this node is not linked.
+             */
+            ThreadQueue* getQueue() const
+            {
+                return queue_;
+            }
+
+            /**
+             * Returns next node of a queue.
+             *
+             * @return next node, or the head node if this node is the tail.
+             */
+            Node* getNext() const
+            {
+                return next_;
+            }
+
+            /**
+             * Tests if this node is linked to a queue.
+             *
+             * @return true if this node is linked.
+             */
+            bool isLinked() const
+            {
+                return queue_ != NULL ? true : false;
+            }
+
+            /**
+             * A value of waiting, for example a number of requested permits.
+             */
+            int32 value;
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj reference to source object.
+             */
+            Node(const Node& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj reference to source object.
+             * @return reference to this object.
+             */
+            Node& operator =(const Node& obj);
+
+            /**
+             * Previous node.
+             */
+            Node* prev_;
+
+            /**
+             * Next node.
+             */
+            Node* next_;
+
+            /**
+             * Queue which contains this node.
+             */
+            ThreadQueue* queue_;
+
+            /**
+             * Linked thread.
+             */
+            SchedulerThread* thread_;
+
+            friend class ThreadQueue;
+
+        };
+
+        /**
+         * Constructor.
+         */
+        ThreadQueue() :
+            head_   (NULL),
+            length_ (0){
+        }
+
+        /**
+         * Destructor.
+         */
+       ~ThreadQueue()
+        {
+            while(head_ != NULL) remove(*head_);
+        }
+
+        /**
+         * Inserts a node to the tail of this queue.
+         *
+         * @param node a unlinked node.
+         */
+        void add(Node& node)
+        {
+            if(node.queue_ != NULL) return;
+            if(head_ == NULL)
+            {
+                node.prev_ = &node;
+                node.next_ = &node;
+                head_ = &node;
+            }
+            else
+            {
+                link(*head_, node);
+            }
+            node.queue_ = this;
+            length_++;
+        }
+
+        /**
+         * Removes a node from this queue.
+         *
+         * @param node a node of this queue.
+         */
+        void remove(Node& node)
+        {
+            if(node.queue_ != this) return;
+            if(node.next_ == &node)
+            {
+                head_ = NULL;
+            }
+            else
+            {
+                if(head_ == &node) head_ = node.next_;
+                node.next_->prev_ = node.prev_;
+                node.prev_->next_ = node.next_;
+            }
+            node.prev_ = &node;
+            node.next_ = &node;
+            node.queue_ = NULL;
+            length_--;
+        }
+
+        /**
+         * Moves the head node of this queue to the tail.
+         */
+        void rotate()
+        {
+            if(head_ != NULL) head_ = head_->next_;
+        }
+
+        /**
+         * Returns the head node of this queue.
+         *
+         * @return the head node, or NULL if this queue is empty.
+         */
+        Node* peek() const
+        {
+            return head_;
+        }
+
+        /**
+         * Returns the tail node of this queue.
+         *
+         * @return the tail node, or NULL if this queue is empty.
+         */
+        Node* getLast() const
+        {
+            return head_ != NULL ? head_->prev_ : NULL;
+        }
+
+        /**
+         * Returns a number of nodes in this queue.
+         *
+         * @return number of nodes.
+         */
+        int32 getLength() const
+        {
+            return length_;
+        }
+
+        /**
+         * Tests if this queue has no nodes.
+         *
+         * @return true if this queue contains no nodes.
+         */
+        bool isEmpty() const
+        {
+            return head_ == NULL ? true : false;
+        }
+
+    private:
+
+        /**
+         * Links a node before a node of this queue.
+         *
+         * @param next a node of this queue.
+         * @param node a linking node.
+         */
+        static void link(Node& next, Node& node)
+        {
+            node.next_ = &next;
+            node.prev_ = next.prev_;
+            next.prev_->next_ = &node;
+            next.prev_ = &node;
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        ThreadQueue(const ThreadQueue& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        ThreadQueue& operator =(const ThreadQueue& obj);
+
+        /**
+         * The head node of this queue.
+         */
+        Node* head_;
+
+        /**
+         * Number of nodes in this queue.
+         */
+        int32 length_;
+
+    };
+}
+#endif // KERNEL_THREAD_QUEUE_HPP_
@@ -0,0 +1,450 @@
+/**
+ * Service of software timers.
+ *
+ * The service holds started timers in a wheel of slots indexed by expiration
+ * ticks, and one thread of the service runs the handlers of expired timers.
+ * Starting and stopping a timer costs constant time regardless of timers number,
+ * and the thread sleeps till the nearest non-empty slot instead of every tick.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#ifndef KERNEL_TIMER_SERVICE_HPP_
+#define KERNEL_TIMER_SERVICE_HPP_
+
+#include "kernel.Object.hpp"
+#include "api.Task.hpp"
+#include "api.Thread.hpp"
+#include "kernel.Kernel.hpp"
+#include "kernel.Semaphore.hpp"
+#include "kernel.ReadyQueue.hpp"
+#include "module.Interrupt.hpp"
+
+namespace kernel
+{
+    class TimerService : public ::kernel::Object, public ::api::Task
+    {
+        typedef ::kernel::Object    Parent;
+        typedef ::module::Interrupt Int;
+
+    public:
+
+        /**
+         * Node of a software timer.
+         */
+        class Node
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param ihandler a task which is run when the timer expires.
+             */
+            Node(::api::Task& ihandler) :
+                handler (ihandler),
+                time    (0),
+                period  (0),
+                prev    (NULL),
+                next    (NULL),
+                list    (NULL){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Node(){}
+
+            /**
+             * The task of the timer.
+             */
+            ::api::Task& handler;
+
+            /**
+             * The expiration tick.
+             */
+            int64 time;
+
+            /**
+             * The period in ticks, or zero for one expiration.
+             */
+            int64 period;
+
+            /**
+             * The previous node of the list.
+             */
+            Node* prev;
+
+            /**
+             * The next node of the list.
+             */
+            Node* next;
+
+            /**
+             * The head of the list which contains the node, or NULL if the timer is stopped.
+             */
+            Node** list;
+
+        };
+
+        /**
+         * Constructor.
+         */
+        TimerService() : Parent(),
+            isConstructed_ (getConstruct()),
+            semaphore_     (NULL),
+            thread_        (NULL),
+            expired_       (NULL),
+            map_           (0),
+            cursor_        (0),
+            wake_          (-1){
+            for(int32 i=0; i<SLOTS; i++) slot_[i] = NULL;
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~TimerService()
+        {
+            delete thread_;
+            delete semaphore_;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Runs the handlers of expired timers.
+         */
+        virtual void main()
+        {
+            while(true)
+            {
+                int64 wake = process();
+                if(wake < 0)
+                {
+                    semaphore_->acquire();
+                    continue;
+                }
+                int64 timeout = wake * TICK - getTime();
+                if(timeout > 0) semaphore_->acquire(1, timeout);
+            }
+        }
+
+        /**
+         * Returns size of stack.
+         *
+         * The stack is shared by handlers of all timers.
+         *
+         * @return stack size in bytes.
+         */
+        virtual int32 getStackSize() const
+        {
+            return STACK_SIZE;
+        }
+
+        /**
+         * Creates the thread of this service if it has not been created.
+         *
+         * @return true if the service is running.
+         */
+        bool initialize()
+        {
+            if( not isConstructed_ ) return false;
+            ::api::Toggle& toggle = Kernel::call().getScheduler().toggle();
+            bool is = toggle.disable();
+            bool res = thread_ != NULL ? true : create();
+            return toggle.enable(is, res);
+        }
+
+        /**
+         * Starts a timer.
+         *
+         * @param node   a node of the timer.
+         * @param delay  the time to first expiration in nanoseconds.
+         * @param period the time between expirations in nanoseconds, or zero for one expiration.
+         * @return true if the timer has been started.
+         */
+        bool start(Node& node, int64 delay, int64 period)
+        {
+            if( not isConstructed_ || thread_ == NULL ) return false;
+            if(delay < 0 || period < 0) return false;
+            int64 time = getTime();
+            bool is = Int::disableAll();
+            unlink(node);
+            node.time = (time + delay + TICK - 1) / TICK;
+            if(node.time <= cursor_) node.time = cursor_ + 1;
+            node.period = (period + TICK - 1) / TICK;
+            link(node, slot_[node.time & MASK]);
+            // The thread has to be woken up earlier than it plans
+            bool isEarlier = wake_ < 0 || node.time < wake_;
+            Int::enableAll(is);
+            if(isEarlier) semaphore_->release();
+            return true;
+        }
+
+        /**
+         * Stops a timer.
+         *
+         * @param node a node of the timer.
+         */
+        void stop(Node& node)
+        {
+            if( not isConstructed_ ) return;
+            bool is = Int::disableAll();
+            unlink(node);
+            Int::enableAll(is);
+        }
+
+    private:
+
+        /**
+         * Expires the timers of elapsed ticks and runs their handlers.
+         *
+         * @return the tick when the thread has to be woken up, or -1 if no timer is started.
+         */
+        int64 process()
+        {
+            int64 now = getTime() / TICK;
+            bool is = Int::disableAll();
+            if(now > cursor_)
+            {
+                Node* tail = expired_;
+                while(tail != NULL && tail->next != NULL) tail = tail->next;
+                int64 count = now - cursor_;
+                if(count > SLOTS) count = SLOTS;
+                for(int64 i=1; i<=count; i++)
+                {
+                    // The nodes are taken from the slot tail, as they are linked to its head on starting
+                    Node* node = slot_[(cursor_ + i) & MASK];
+                    while(node != NULL && node->next != NULL) node = node->next;
+                    while(node != NULL)
+                    {
+                        Node* prev = node->prev;
+                        if(node->time <= now) expire(*node, tail);
+                        node = prev;
+                    }
+                }
+                cursor_ = now;
+            }
+            Int::enableAll(is);
+            while(true)
+            {
+                is = Int::disableAll();
+                Node* node = expired_;
+                if(node == NULL) break;
+                unlink(*node);
+                // Periods which have been missed are skipped
+                if(node->period != 0)
+                {
+                    node->time += node->period;
+                    if(node->time <= cursor_) node->time += ( (cursor_ - node->time) / node->period + 1 ) * node->period;
+                    link(*node, slot_[node->time & MASK]);
+                }
+                Int::enableAll(is);
+                node->handler.main();
+            }
+            wake_ = getWake();
+            return Int::enableAll(is, wake_);
+        }
+
+        /**
+         * Returns the tick of the nearest non-empty slot.
+         *
+         * @return the tick, or -1 if all slots are empty.
+         */
+        int64 getWake() const
+        {
+            if(map_ == 0) return -1;
+            // Rotate the map to place the slot of the next tick to the most significant bit
+            int32 index = static_cast<int32>( (cursor_ + 1) & MASK );
+            uint32 map = index == 0 ? map_ : (map_ << index) | (map_ >> (SLOTS - index));
+            return cursor_ + 1 + ReadyQueue::countLeadingZeros(map);
+        }
+
+        /**
+         * Moves a node to the expired timers in order of their expiration ticks.
+         *
+         * The node is appended after the timers which expire not later than it,
+         * so the handlers are run in order of expiration, and the timers which
+         * expire at one tick are run in order of starting.
+         *
+         * @param node a node of a slot.
+         * @param tail the tail node of the expired timers, or NULL if they are empty.
+         */
+        void expire(Node& node, Node*& tail)
+        {
+            unlink(node);
+            Node* prev = tail;
+            while(prev != NULL && prev->time > node.time) prev = prev->prev;
+            node.prev = prev;
+            node.next = prev != NULL ? prev->next : expired_;
+            node.list = &expired_;
+            if(node.next != NULL) node.next->prev = &node;
+            else tail = &node;
+            if(prev != NULL) prev->next = &node;
+            else expired_ = &node;
+        }
+
+        /**
+         * Inserts a node to the head of a list.
+         *
+         * @param node a unlinked node.
+         * @param list a head of the list.
+         */
+        void link(Node& node, Node*& list)
+        {
+            node.prev = NULL;
+            node.next = list;
+            if(list != NULL) list->prev = &node;
+            list = &node;
+            node.list = &list;
+            int32 index = getSlot(node);
+            if(index >= 0) map_ |= 0x80000000 >> index;
+        }
+
+        /**
+         * Removes a node from its list.
+         *
+         * @param node a node.
+         */
+        void unlink(Node& node)
+        {
+            if(node.list == NULL) return;
+            if(node.prev != NULL) node.prev->next = node.next;
+            else *node.list = node.next;
+            if(node.next != NULL) node.next->prev = node.prev;
+            int32 index = getSlot(node);
+            if(index >= 0 && slot_[index] == NULL) map_ &= ~(0x80000000 >> index);
+            node.prev = NULL;
+            node.next = NULL;
+            node.list = NULL;
+        }
+
+        /**
+         * Returns an index of the slot which contains a node.
+         *
+         * @param node a linked node.
+         * @return the slot index, or -1 if the node is not contained in a slot.
+         */
+        int32 getSlot(const Node& node) const
+        {
+            if(node.list < &slot_[0] || &slot_[SLOTS - 1] < node.list) return -1;
+            return static_cast<int32>(node.list - &slot_[0]);
+        }
+
+        /**
+         * Creates the thread of this service.
+         *
+         * @return true if the thread has been started.
+         */
+        bool create()
+        {
+            semaphore_ = new Semaphore(0);
+            if(semaphore_ == NULL || not semaphore_->isConstructed()) return false;
+            ::api::Thread* thread = Kernel::call().getScheduler().createThread(*this);
+            if(thread == NULL) return false;
+            cursor_ = getTime() / TICK;
+            thread->setPriority( ::api::Thread::MAX_PRIORITY );
+            thread->start();
+            thread_ = thread;
+            return true;
+        }
+
+        /**
+         * Returns current time.
+         *
+         * @return the kernel running time in nanoseconds.
+         */
+        static int64 getTime()
+        {
+            return Kernel::call().getExecutionTime().getValue();
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        TimerService(const TimerService& obj);
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        TimerService& operator =(const TimerService& obj);
+
+        /**
+         * Duration of one tick in nanoseconds.
+         */
+        static const int32 TICK = 1000000;
+
+        /**
+         * Number of the wheel slots.
+         */
+        static const int32 SLOTS = 32;
+
+        /**
+         * Mask of the slot indexes.
+         */
+        static const int32 MASK = SLOTS - 1;
+
+        /**
+         * Size of the service thread stack in bytes.
+         */
+        static const int32 STACK_SIZE = 0x1000;
+
+        /**
+         * The root object constructed flag.
+         */
+        const bool& isConstructed_;
+
+        /**
+         * Semaphore which wakes the thread up for starting timers.
+         */
+        Semaphore* semaphore_;
+
+        /**
+         * The thread of this service.
+         */
+        ::api::Thread* thread_;
+
+        /**
+         * Timers which have expired and their handlers have not been run.
+         */
+        Node* expired_;
+
+        /**
+         * Bitmap of non-empty slots where the most significant bit is the zero slot.
+         */
+        uint32 map_;
+
+        /**
+         * The last processed tick.
+         */
+        int64 cursor_;
+
+        /**
+         * The tick when the thread plans to be woken up, or -1 if it waits for starting timers.
+         */
+        int64 wake_;
+
+        /**
+         * Slots of the wheel.
+         */
+        Node* slot_[SLOTS];
+
+    };
+}
+#endif // KERNEL_TIMER_SERVICE_HPP_
@@ -57,6 +57,7 @@ namespace module
             T64P1_TINT12       = 23,
             T64P1_TINT34       = 24,
             UART0_INT          = 25,
+            SWINT              = 26, // Reserved source which is set by software only
             PROTERR            = 27,
             SYSCFG_CHIPINT0    = 28,
             SYSCFG_CHIPINT1    = 29,
@@ -535,7 +536,6 @@ namespace module
         static bool isSource(int32 source)
         {
           if(source < 0 || source > 100 ) return false;
-          if(source == 26) return false;      
           if(28 <= source && source <= 31) return false;
           if(source == 62) return false;
           #ifdef EOOS_AM1806
@@ -48,7 +48,8 @@ namespace module
             TINT2      = 0x13, // Timer 2 interrupt
             SD_INTB    = 0x14, // EMIFB SDRAM timer interrupt
             PCI_WAKEUP = 0x15, // PCI wakeup interrupt
-            UINT       = 0x17  // UTOPIA interupt
+            UINT       = 0x17, // UTOPIA interupt
+            SWINT      = 0x1f  // Reserved event which is set by software only
         };  
       
         /** 
@@ -219,6 +220,10 @@ namespace module
                     src = UINT;       
                     break;
                     
+                case SWINT: 
+                    src = SWINT;      
+                    break;
+                    
                 default: 
                     return false;
             }
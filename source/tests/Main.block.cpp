@@ -0,0 +1,161 @@
+/**
+ * User main class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#include "Main.hpp"
+#include "system.Thread.hpp"
+#include "system.Semaphore.hpp"
+#include "system.System.hpp"
+
+/**
+ * User resource class which does not notify waiting threads.
+ */
+class Flag : public ::api::Resource
+{
+
+public:
+
+    /**
+     * Constructor.
+     */
+    Flag() :
+        isSet_ (false){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Flag()
+    {
+    }
+
+    /**
+     * Tests if this object has been constructed.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    virtual bool isConstructed() const
+    {
+        return true;
+    }
+
+    /**
+     * Tests if this resource is blocked.
+     *
+     * @return true if the flag is not set.
+     */
+    virtual bool isBlocked()
+    {
+        return isSet_ ? false : true;
+    }
+
+    /**
+     * Sets the flag.
+     */
+    void set()
+    {
+        isSet_ = true;
+    }
+
+private:
+
+    /**
+     * The flag value.
+     */
+    volatile bool isSet_;
+
+};
+
+/**
+ * User thread class which waits for any of several resources.
+ */
+class Waiter : public ::system::Thread
+{
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param resources an array of resources.
+     * @param count     a number of the resources.
+     */
+    Waiter(::api::Resource* const* resources, int32 count) :
+        resources_ (resources),
+        count_     (count),
+        index_     (-1){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Waiter()
+    {
+    }
+
+    /**
+     * The main method of this thread.
+     */
+    void main()
+    {
+        index_ = block(resources_, count_);
+    }
+
+    /**
+     * The array of resources.
+     */
+    ::api::Resource* const* resources_;
+
+    /**
+     * The number of the resources.
+     */
+    int32 count_;
+
+    /**
+     * The index of the resource which is not blocked.
+     */
+    volatile int32 index_;
+
+};
+
+/**
+ * User method which will be stated as first.
+ *
+ * @return error code or zero.
+ */
+int32 Main::main()
+{
+    ::api::Thread& thread = ::system::Thread::getCurrent();
+    ::system::Semaphore sem1(0);
+    ::system::Semaphore sem2(0);
+    Flag flag;
+    if(!sem1.isConstructed() ||
+       !sem2.isConstructed()) return 1;
+    // The waiter is woken up by the semaphore which has been released
+    ::api::Resource* kernel[] = {&sem1, &sem2};
+    Waiter thr1(kernel, 2);
+    if(!thr1.isConstructed()) return 1;
+    thr1.start();
+    thread.sleep(10);
+    if(thr1.getStatus() != ::api::Thread::WAITING) return 2;
+    sem2.release();
+    thr1.join();
+    if(thr1.index_ != 1) return 3;
+    if(!sem2.tryAcquire()) return 4;
+    // The waiter is woken up by the scheduler which polls the user resource
+    ::api::Resource* mixed[] = {&sem1, &flag};
+    Waiter thr2(mixed, 2);
+    if(!thr2.isConstructed()) return 1;
+    thr2.start();
+    thread.sleep(10);
+    if(thr2.getStatus() != ::api::Thread::BLOCKED) return 5;
+    flag.set();
+    thr2.join();
+    if(thr2.index_ != 1) return 6;
+    // No resource is released in time
+    if(thread.block(kernel, 2, 1000000) != -1) return 7;
+    return 0;
+}
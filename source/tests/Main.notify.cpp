@@ -0,0 +1,127 @@
+/**
+ * User main class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#include "Main.hpp"
+#include "system.Thread.hpp"
+#include "system.System.hpp"
+
+/**
+ * User thread class which waits for notifications.
+ */
+class Waiter : public ::system::Thread
+{
+
+public:
+
+    /**
+     * Constructor.
+     */
+    Waiter() :
+        first_  (0),
+        second_ (0){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Waiter()
+    {
+    }
+
+    /**
+     * The main method of this thread.
+     */
+    void main()
+    {
+        first_ = waitNotification(0x3);
+        second_ = waitNotification(0x4, 1000000000);
+    }
+
+    /**
+     * The bits of the first notification.
+     */
+    volatile uint32 first_;
+
+    /**
+     * The bits of the second notification.
+     */
+    volatile uint32 second_;
+
+};
+
+/**
+ * User thread class which counts its executions.
+ */
+class Counter : public ::system::Thread
+{
+
+public:
+
+    /**
+     * Constructor.
+     */
+    Counter() :
+        count_ (0){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Counter()
+    {
+    }
+
+    /**
+     * The main method of this thread.
+     */
+    void main()
+    {
+        for(int32 i=0; i<100; i++) count_ = count_ + 1;
+    }
+
+    /**
+     * The number of executions.
+     */
+    volatile int32 count_;
+
+};
+
+/**
+ * User method which will be stated as first.
+ *
+ * @return error code or zero.
+ */
+int32 Main::main()
+{
+    ::api::Thread& thread = ::system::Thread::getCurrent();
+    thread.setPriority(::api::Thread::NORM_PRIORITY + 1);
+    Waiter waiter;
+    Counter counter;
+    if(!waiter.isConstructed() ||
+       !counter.isConstructed()) return 1;
+    waiter.setPriority(::api::Thread::NORM_PRIORITY);
+    counter.setPriority(::api::Thread::MIN_PRIORITY);
+    // Let the waiter block on the notification
+    waiter.start();
+    thread.sleep(10);
+    if(waiter.getStatus() != ::api::Thread::WAITING) return 2;
+    // Notify the waiter twice before it is executed
+    waiter.notify(0x1);
+    waiter.notify(0x2);
+    if(waiter.getStatus() != ::api::Thread::RUNNABLE) return 3;
+    // The woken waiter gets both bits of the notifications
+    thread.sleep(10);
+    if(waiter.first_ != 0x3) return 4;
+    waiter.notify(0x4);
+    waiter.join();
+    if(waiter.second_ != 0x4) return 5;
+    // The lower priority thread is still scheduled
+    counter.start();
+    counter.join();
+    if(counter.count_ != 100) return 6;
+    return 0;
+}
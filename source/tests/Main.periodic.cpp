@@ -0,0 +1,139 @@
+/**
+ * User main class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#include "Main.hpp"
+#include "system.Thread.hpp"
+#include "system.System.hpp"
+
+/**
+ * User periodic thread class.
+ */
+class Thread : public ::system::Thread
+{
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param period   the thread period in nanoseconds.
+     * @param budget   the thread execution time in each period in nanoseconds.
+     * @param deadline the relative deadline of each period in nanoseconds.
+     */
+    Thread(int64 period, int64 budget, int64 deadline) : ::system::Thread(period, budget, deadline),
+        count_ (0){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Thread()
+    {
+    }
+
+    /**
+     * The main method of this thread.
+     */
+    void main()
+    {
+        volatile uint32 v = 0;
+        for(count_ = 0; count_ < 100; count_++)
+        {
+            for(int32 i=0; i<1000; i++) v = v + 1;
+            waitNextPeriod();
+        }
+    }
+
+    /**
+     * The number of executed periods.
+     */
+    int32 count_;
+
+};
+
+/**
+ * User thread class which is periodic without a reservation.
+ */
+class PlainThread : public ::system::Thread
+{
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param period  the thread period in nanoseconds.
+     * @param overrun the execution time of the first period in nanoseconds.
+     */
+    PlainThread(int64 period, int64 overrun) : ::system::Thread(),
+        period_  (period),
+        overrun_ (overrun){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~PlainThread()
+    {
+    }
+
+    /**
+     * The main method of this thread.
+     */
+    void main()
+    {
+        setPeriod(period_);
+        // Overrun the first period
+        int64 time = ::system::System::call().getTimeNs() + overrun_;
+        while( ::system::System::call().getTimeNs() < time ){}
+        waitNextPeriod();
+        // Complete the next periods in time
+        for(int32 i=0; i<10; i++) waitNextPeriod();
+    }
+
+    /**
+     * The thread period in nanoseconds.
+     */
+    int64 period_;
+
+    /**
+     * The execution time of the first period in nanoseconds.
+     */
+    int64 overrun_;
+
+};
+
+/**
+ * User method which will be stated as first.
+ *
+ * @return error code or zero.
+ */
+int32 Main::main()
+{
+    // Create the threads which utilization is 0.7
+    Thread thr1(10000000, 2000000, 10000000);
+    Thread thr2(20000000, 5000000, 10000000);
+    if(!thr1.isConstructed() ||
+       !thr2.isConstructed()) return 1;
+    // The thread which exceeds the processor time is not admitted
+    Thread thr3(10000000, 4000000, 10000000);
+    if(thr3.isConstructed()) return 2;
+    // Start the threads
+    thr1.start();
+    thr2.start();
+    thr1.join();
+    thr2.join();
+    if(thr1.getMissCount() != 0 || thr2.getMissCount() != 0) return 3;
+    // The fixed priority thread overruns its first period once, and misses no deadline
+    PlainThread thr4(10000000, 15000000);
+    if(!thr4.isConstructed()) return 4;
+    thr4.setPriority(::api::Thread::NORM_PRIORITY);
+    thr4.start();
+    thr4.join();
+    if(thr4.getOverrunCount() != 1 || thr4.getMissCount() != 0) return 5;
+    return 0;
+}
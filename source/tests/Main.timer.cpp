@@ -0,0 +1,123 @@
+/**
+ * User main class.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2017, Embedded Team, Sergey Baigudin
+ * @license   http://embedded.team/license/
+ */
+#include "Main.hpp"
+#include "system.Thread.hpp"
+#include "system.SoftwareTimer.hpp"
+#include "system.System.hpp"
+
+/**
+ * The indexes of the run handlers in order of running.
+ */
+static volatile int32 order[5];
+
+/**
+ * The number of the run handlers.
+ */
+static volatile int32 count = 0;
+
+/**
+ * User timer handler class.
+ */
+class Handler : public ::api::Task
+{
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param index an index of this handler.
+     */
+    Handler(int32 index) :
+        index_ (index){
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~Handler()
+    {
+    }
+
+    /**
+     * Tests if this object has been constructed.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    virtual bool isConstructed() const
+    {
+        return true;
+    }
+
+    /**
+     * The main method of this handler.
+     */
+    virtual void main()
+    {
+        if(count < 5) order[count] = index_;
+        count = count + 1;
+    }
+
+    /**
+     * Returns size of stack.
+     *
+     * @return stack size in bytes.
+     */
+    virtual int32 getStackSize() const
+    {
+        return 0;
+    }
+
+private:
+
+    /**
+     * The index of this handler.
+     */
+    int32 index_;
+
+};
+
+/**
+ * User method which will be stated as first.
+ *
+ * @return error code or zero.
+ */
+int32 Main::main()
+{
+    Handler hdr0(0), hdr1(1), hdr2(2), hdr3(3), hdr4(4);
+    ::system::SoftwareTimer tmr0(hdr0);
+    ::system::SoftwareTimer tmr1(hdr1);
+    ::system::SoftwareTimer tmr2(hdr2);
+    ::system::SoftwareTimer tmr3(hdr3);
+    ::system::SoftwareTimer tmr4(hdr4);
+    if(!tmr0.isConstructed() ||
+       !tmr1.isConstructed() ||
+       !tmr2.isConstructed() ||
+       !tmr3.isConstructed() ||
+       !tmr4.isConstructed()) return 1;
+    // Keep the service thread from running till all the timers expire
+    ::api::Toggle& toggle = ::system::Thread::toggle();
+    bool is = toggle.disable();
+    // The timer of 33 ms shares the slot of 1 ms timers as the wheel has 32 slots
+    tmr4.start(33000000);
+    tmr3.start(3000000);
+    tmr0.start(1000000);
+    tmr2.start(2000000);
+    tmr1.start(1000000);
+    int64 time = ::system::System::call().getTimeNs() + 40000000;
+    while( ::system::System::call().getTimeNs() < time ){}
+    toggle.enable(is);
+    // The handlers are run in order of expiration, and in order of starting for one tick
+    ::system::Thread::getCurrent().sleep(10);
+    if(count != 5) return 2;
+    for(int32 i=0; i<5; i++)
+    {
+        if(order[i] != i) return 3;
+    }
+    return 0;
+}